@@ -38,9 +38,14 @@
 #include "driverlib/sysctl.h"
 #include "driverlib/gpio.h"
 #include "driverlib/adc.h"
+#include "driverlib/interrupt.h"
 #include "driverlib/pin_map.h"
 #include "driverlib/uart.h"
 #include "utils/uartstdio.h"
+#include "../utils/uart_dma.h"
+#include "../utils/uart_cfg.h"
+#include "../utils/tlog.h"
+#include "tlog_ids.h"       // Generated by the pre-build step (tlog/tlog_gen.py)
 
 void ADCSeq0Handler(void) {}
 
@@ -54,8 +59,13 @@ void ConfigureUART(void)
     GPIOPinConfigure(GPIO_PA1_U0TX);
     GPIOPinTypeUART(GPIO_PORTA_BASE, GPIO_PIN_0 | GPIO_PIN_1);
 
-    UARTClockSourceSet(UART0_BASE, UART_CLOCK_PIOSC);
-    UARTStdioConfig(0, 115200, 16000000);
+    // 115200 8N1 from the system clock; the faster profiles need a
+    // USB-UART adapter instead of the ICDI virtual COM port
+    UART_configure(UART0_BASE, UART_PROFILE_115200, false);
+
+    // Buffered output: UART_tx_printf() queues, uDMA drains
+    UART_tx_init();
+    IntMasterEnable();
 }
 
 int main(void)
@@ -66,8 +76,11 @@ int main(void)
     SysCtlClockSet(SYSCTL_SYSDIV_5 | SYSCTL_USE_PLL |
                    SYSCTL_OSC_MAIN | SYSCTL_XTAL_16MHZ);
 
+    // Output is tokenized: read it with tlog/tlog_decode tlog_table.txt
     ConfigureUART();
-    UARTprintf("Simple ADC + UART demo\n");
+    TLOG_init(TLOG_TABLE_HASH);
+    TLOG(ANALOG_START, "Simple ADC + UART demo\n");
+    TLOG_drain();
 
     // Enable ADC0 and GPIOE (for PE3 / AIN0)
     SysCtlPeripheralEnable(SYSCTL_PERIPH_ADC0);
@@ -93,8 +106,9 @@ int main(void)
         // Read the ADC value
         ADCSequenceDataGet(ADC0_BASE, 3, &adcValue);
 
-        // Print result
-        UARTprintf("ADC Value: %4d\n", adcValue);
+        // Log the result: an ID and one word, formatted on the host
+        TLOG(ADC_VALUE, "ADC Value: %4d\n", adcValue);
+        TLOG_drain();
 
         SysCtlDelay(SysCtlClockGet() / 300); // ~1 second delay at 40MHz
     }
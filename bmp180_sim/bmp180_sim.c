@@ -0,0 +1,250 @@
+/******************************************************************************
+ * Project  : BMP180 host-side simulator
+ * File     : bmp180_sim.c
+ *
+ * Description:
+ * Runs the BMP180 driver from char16display_bmp180/bmp180.c on a Linux PC,
+ * with no LaunchPad attached. The I2C_write(), I2C_read_multiple() and
+ * delay_us() calls the driver makes are answered by a model of the sensor:
+ * register map, calibration EEPROM (datasheet example values), conversion
+ * times per OSS and RMS noise per OSS. Time is virtual: delays and bus
+ * transfers (at the chosen SCL rate) advance a simulated clock.
+ *
+ * The harness reports
+ *   - achievable sample rate and output noise for every OSS / bus speed
+ *   - what BMP180_configure() picks for a range of requested rates
+ *   - host throughput of BMP180_compensate()
+ *
+ * Build and run (from this folder):
+ *   gcc -O2 -Wall -I../char16display_bmp180 bmp180_sim.c \
+ *       ../char16display_bmp180/bmp180.c -lm -o bmp180_sim
+ *   ./bmp180_sim
+ *
+ * Author   : Jithin B.P.
+ * Affiliation: CSpark Research
+ * Email    : jithinuser@gmail.com
+ *
+ * License  : This source code is released under an open-source license.
+ * You may use, modify, and distribute it freely, provided that
+ * proper attribution is given to the original author.
+ *
+ * Created  : 2025
+ ******************************************************************************/
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdlib.h>
+#include <math.h>
+#include <time.h>
+#include "bmp180.h"
+
+#define SIM_CHIP_ID         0x55
+#define SIM_UT              27898       // Datasheet example: 15.0 C
+#define SIM_UP              23843       // Datasheet example (OSS0): 69964 Pa
+#define SIM_TEMP_CONV_US    4500
+
+// Datasheet calibration example, in register order (0xAA..0xBF)
+static const int16_t sim_calib[11] = {
+    408, -72, -14383, (int16_t)32741, (int16_t)32757, 23153,
+    6190, 4, -32768, -8711, 2868
+};
+
+// Typical conversion time per OSS (us) and RMS noise (Pa), from the datasheet
+static const uint32_t sim_conv_us[4] = {4500, 7500, 13500, 25500};
+static const double sim_noise_pa[4] = {6.0, 5.0, 4.0, 3.0};
+
+static uint8_t sim_regs[256];
+static double sim_now_us;               // Virtual time
+static double sim_ready_us;             // When the running conversion ends
+static uint8_t sim_ctrl;                // Last value written to 0xF4
+static double sim_pa_per_count;         // UP sensitivity at OSS0
+static uint32_t sim_early_reads;        // Results read before conversion end
+static uint32_t sim_bus_hz = 100000;
+
+// ===============================================
+//          Sensor model
+// ===============================================
+
+static double sim_gauss(void) {
+    double u1 = (rand() + 1.0) / (RAND_MAX + 2.0);
+    double u2 = (rand() + 1.0) / (RAND_MAX + 2.0);
+    return sqrt(-2.0 * log(u1)) * cos(2.0 * M_PI * u2);
+}
+
+static void sim_bus_bits(uint32_t bits) {
+    sim_now_us += bits * 1e6 / sim_bus_hz;
+}
+
+// Latches the result of the running conversion into 0xF6..0xF8
+static void sim_finish_conversion(void) {
+    uint8_t oss;
+    int32_t up;
+
+    if (!(sim_regs[REG_CONTROL] & 0x20) || sim_now_us < sim_ready_us) return;
+    sim_regs[REG_CONTROL] &= ~0x20;
+
+    if (sim_ctrl == CMD_READ_TEMP) {
+        sim_regs[REG_MSB] = SIM_UT >> 8;
+        sim_regs[REG_LSB] = SIM_UT & 0xFF;
+    } else {
+        oss = sim_ctrl >> 6;
+        up = (SIM_UP << oss) +
+             (int32_t)lround(sim_gauss() * sim_noise_pa[oss] * (1 << oss) / sim_pa_per_count);
+        up <<= 8 - oss;
+        sim_regs[REG_MSB] = (up >> 16) & 0xFF;
+        sim_regs[REG_LSB] = (up >> 8) & 0xFF;
+        sim_regs[REG_XLSB] = up & 0xFF;
+    }
+}
+
+static void sim_reset(void) {
+    int i;
+
+    for (i = 0; i < 256; i++) sim_regs[i] = 0;
+    for (i = 0; i < 11; i++) {
+        sim_regs[REG_CALIB_START + 2 * i] = (uint16_t)sim_calib[i] >> 8;
+        sim_regs[REG_CALIB_START + 2 * i + 1] = (uint16_t)sim_calib[i] & 0xFF;
+    }
+    sim_regs[0xD0] = SIM_CHIP_ID;
+    sim_regs[REG_MSB] = 0x80;
+    sim_ready_us = 0;
+}
+
+// ===============================================
+//          Platform hooks used by bmp180.c
+// ===============================================
+
+uint32_t I2C_write(uint8_t reg, uint8_t data) {
+    sim_bus_bits(2 + 3 * 9);            // START, addr, reg, data, STOP
+    sim_finish_conversion();
+
+    if (reg == 0xE0 && data == 0xB6) {
+        sim_reset();
+    } else if (reg == REG_CONTROL) {
+        // 0x2E / 0x34+(oss<<6) both carry the start-of-conversion bit (0x20),
+        // which reads back as set until the result is ready
+        sim_ctrl = data;
+        sim_regs[REG_CONTROL] = data | 0x20;
+        sim_ready_us = sim_now_us + (sim_ctrl == CMD_READ_TEMP ?
+                                     SIM_TEMP_CONV_US : sim_conv_us[sim_ctrl >> 6]);
+    } else {
+        sim_regs[reg] = data;
+    }
+    return 0;
+}
+
+uint32_t I2C_read_multiple(uint8_t reg, uint8_t count, uint8_t *data) {
+    sim_bus_bits(4 + 2 * 9 + (1 + count) * 9); // addr+reg, repeated START, addr+data
+    sim_finish_conversion();
+
+    if (reg >= REG_MSB && reg <= REG_XLSB && (sim_regs[REG_CONTROL] & 0x20))
+        sim_early_reads++;
+    while (count--) *data++ = sim_regs[reg++];
+    return 0;
+}
+
+void delay_us(uint32_t us) {
+    sim_now_us += us;
+}
+
+// ===============================================
+//          Harness
+// ===============================================
+
+// Runs the same loop as the LaunchPad example for n pressure samples and
+// returns the achieved rate (samples/s of virtual time) and RMS noise (Pa).
+static double sim_run(uint32_t n, bool paced, double *rms_pa) {
+    int32_t ut = 0, up;
+    float t, p;
+    double start, next, sum = 0, sum2 = 0;
+    uint32_t i, used = 0;
+
+    sim_early_reads = 0;
+    start = next = sim_now_us;
+    for (i = 0; i < n; i++) {
+        // Fixed period, as on the LaunchPad: wait for the next slot, or
+        // restart the schedule after an overrun
+        if (paced) {
+            if (sim_now_us < next) delay_us((uint32_t)ceil(next - sim_now_us));
+            else next = sim_now_us;
+            next += bmp180_period_us;
+        }
+        if (i % bmp180_temp_every == 0) ut = BMP180_read_UT();
+        up = BMP180_read_UP();
+        BMP180_compensate(ut, up, &t, &p);
+        p = BMP180_filter_pressure(p);
+
+        if (i >= 64) {                  // Let the IIR settle
+            sum += p;
+            sum2 += (double)p * p;
+            used++;
+        }
+    }
+    *rms_pa = sqrt(sum2 / used - (sum / used) * (sum / used));
+    return n / ((sim_now_us - start) / 1e6);
+}
+
+static void sim_set_bus(uint32_t hz) {
+    sim_bus_hz = hz;
+    bmp180_bus_hz = hz;
+}
+
+int main(void) {
+    static const uint32_t bus_hz[] = {100000, 400000, 1000000};
+    static const uint32_t rates[] = {1, 5, 10, 25, 50, 100, 150, 200};
+    float t, p, p1;
+    double rate, rms, ns;
+    struct timespec t0, t1;
+    uint32_t i, b, oss;
+    volatile float sink = 0;
+
+    srand(1);
+    sim_reset();
+    BMP180_read_calib_data();
+
+    // Sensitivity of the compensation to one UP count, for the noise model
+    bmp180_oss = 0;
+    BMP180_compensate(SIM_UT, SIM_UP, &t, &p);
+    BMP180_compensate(SIM_UT, SIM_UP + 1, &t, &p1);
+    sim_pa_per_count = fabs(p1 - p);
+    printf("Datasheet example: T = %.1f C, P = %.0f Pa (expected 15.0 C, 69964 Pa)\n\n",
+           t, p);
+
+    printf("Fixed OSS, back-to-back sampling, no smoothing\n");
+    printf("  bus       OSS  samples/s  noise(Pa)  early reads\n");
+    for (b = 0; b < 3; b++) {
+        sim_set_bus(bus_hz[b]);
+        for (oss = 0; oss <= BMP180_OSS_MAX; oss++) {
+            bmp180_oss = oss;
+            bmp180_iir_shift = 0;
+            bmp180_temp_every = 50;
+            rate = sim_run(2000, false, &rms);
+            printf("  %4u kHz  %u    %7.1f    %5.2f      %u\n",
+                   bus_hz[b] / 1000, oss, rate, rms, sim_early_reads);
+        }
+    }
+
+    printf("\nBMP180_configure(rate, %u) at 400 kHz\n", 30);
+    printf("  asked(Hz)  OSS  IIR k  got(Hz)  noise(Pa)\n");
+    sim_set_bus(400000);
+    for (i = 0; i < sizeof(rates) / sizeof(rates[0]); i++) {
+        BMP180_configure(rates[i], 30);
+        rate = sim_run(rates[i] < 64 ? 2000 : 20 * rates[i], true, &rms);
+        printf("  %5u      %u    %u     %7.1f   %5.2f\n",
+               rates[i], bmp180_oss, bmp180_iir_shift, rate, rms);
+    }
+
+    printf("\nCompensation throughput (host)\n");
+    bmp180_oss = 3;
+    clock_gettime(CLOCK_MONOTONIC, &t0);
+    for (i = 0; i < 1000000; i++) {
+        BMP180_compensate(SIM_UT, (SIM_UP << 3) + (i & 255), &t, &p);
+        sink += p;
+    }
+    clock_gettime(CLOCK_MONOTONIC, &t1);
+    ns = ((t1.tv_sec - t0.tv_sec) * 1e9 + (t1.tv_nsec - t0.tv_nsec)) / 1e6;
+    printf("  BMP180_compensate: %.1f ns/call, %.2f M calls/s\n", ns, 1000.0 / ns);
+
+    return 0;
+}
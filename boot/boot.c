@@ -0,0 +1,291 @@
+/******************************************************************************
+ * Project  : Boot-time image verifier (SHA-256 / HMAC-SHA-256 + UART)
+ * File     : boot.c
+ *
+ * Description:
+ *   Runs from reset, checks the application image in flash against its
+ *   descriptor (see boot_image.h) and only then starts it. A bad or missing
+ *   image is reported on UART0 and the red LED blinks; nothing is started.
+ *
+ *   The image is hashed in place: HASH_update() is handed 4 KB slices of
+ *   flash, and the software SHA-256 compresses straight from the flash
+ *   addresses, so no part of the image is copied to RAM. The time taken is
+ *   measured with the DWT cycle counter and printed with the result.
+ *
+ *   With BOOT_SIGNED set the descriptor must carry an HMAC-SHA-256 under the
+ *   boot key, so only images signed with that key start. The key lives
+ *   alone in the 2 KB flash block at BOOT_KEY_ADDR, which is made
+ *   execute-only (unreadable) until the next reset just before the jump, so
+ *   the application cannot read it. All of SRAM, the boot's stack and hash
+ *   context included, is cleared on the way into the application, so no
+ *   copy of the key or of the padded key survives there either. With
+ *   BOOT_SIGNED clear a plain SHA-256 is accepted, which catches corruption
+ *   but not a deliberate change.
+ *
+ *   Build the application with APP_BASE 0x00004000 and a flash length of
+ *   0x3BC00 in its .cmd file, then run image_sign.py on its .bin.
+ *
+ * Author   : Jithin B.P.
+ * Affiliation: CSpark Research
+ * Email    : jithinuser@gmail.com
+ *
+ * License  : This source code is released under an open-source license.
+ *            You may use, modify, and distribute it freely, provided that
+ *            proper attribution is given to the original author.
+ *
+ * Created  : 2025
+ ******************************************************************************/
+#include <stdint.h>
+#include <stdbool.h>
+#include "inc/hw_memmap.h"
+#include "inc/hw_types.h"
+#include "inc/hw_nvic.h"
+#include "driverlib/sysctl.h"
+#include "driverlib/gpio.h"
+#include "driverlib/uart.h"
+#include "driverlib/flash.h"
+#include "driverlib/pin_map.h"
+#include "utils/uartstdio.h"
+#include "../utils/hash_stream.h"
+#include "boot_image.h"
+
+#define BOOT_SIGNED     1               // 1: HMAC descriptors only; 0: SHA-256
+#define BOOT_BENCH      0               // 1: also time SHA-256 over all 256 KB
+#define BOOT_CHUNK      4096            // Flash bytes per HASH_update()
+
+#define FLASH_SIZE      0x00040000
+#define SRAM_BASE       0x20000000
+#define SRAM_SIZE       0x00008000
+
+// Cycle counter; DEMCR.TRCENA powers the DWT when no debugger has
+#define DEMCR           0xE000EDFC
+#define DEMCR_TRCENA    0x01000000
+#define DWT_CTRL        0xE0001000
+#define DWT_CYCCNT      0xE0001004
+
+typedef enum {
+    BOOT_OK,
+    BOOT_NO_DESCRIPTOR,     // Erased or foreign descriptor page
+    BOOT_BAD_LENGTH,        // Image does not fit the application region
+    BOOT_WRONG_KIND,        // SHA-256 where HMAC is required, or the reverse
+    BOOT_BAD_DIGEST,        // Image or descriptor changed since signing
+    BOOT_BAD_VECTORS        // Stack or reset vector outside the image
+} boot_status_t;
+
+static const char * const statusText[] = {
+    "ok", "no descriptor", "bad length", "wrong digest kind",
+    "digest mismatch", "bad vector table"
+};
+
+// Replace with your own key, and keep it out of the source tree. The
+// section is placed alone in the block at BOOT_KEY_ADDR by boot_ccs.cmd.
+#pragma DATA_SECTION(bootKey, ".bootkey")
+const uint8_t bootKey[BOOT_KEY_SIZE] = {
+    0x6b, 0x65, 0x79, 0x2d, 0x63, 0x68, 0x61, 0x6e,
+    0x67, 0x65, 0x2d, 0x6d, 0x65, 0x2d, 0x62, 0x65,
+    0x66, 0x6f, 0x72, 0x65, 0x2d, 0x75, 0x73, 0x65,
+    0x2d, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36
+};
+
+void ConfigureUART(void)
+{
+    SysCtlPeripheralEnable(SYSCTL_PERIPH_GPIOA);
+    SysCtlPeripheralEnable(SYSCTL_PERIPH_UART0);
+
+    GPIOPinConfigure(GPIO_PA0_U0RX);
+    GPIOPinConfigure(GPIO_PA1_U0TX);
+    GPIOPinTypeUART(GPIO_PORTA_BASE, GPIO_PIN_0 | GPIO_PIN_1);
+
+    UARTClockSourceSet(UART0_BASE, UART_CLOCK_PIOSC);
+    UARTStdioConfig(0, 115200, 16000000);
+}
+
+// Hashes len bytes of flash from addr in BOOT_CHUNK slices, read in place
+static void HashFlash(hash_ctx_t *c, uint32_t addr, uint32_t len)
+{
+    uint32_t n;
+
+    while (len) {
+        n = (len < BOOT_CHUNK) ? len : BOOT_CHUNK;
+        HASH_update(c, (const void *)addr, n);
+        addr += n;
+        len -= n;
+    }
+}
+
+// Compares every byte whatever the first difference, so the time taken
+// says nothing about how much of a forged digest was right
+static bool DigestEqual(const uint8_t *a, const uint8_t *b)
+{
+    uint8_t diff = 0;
+    uint32_t i;
+
+    for (i = 0; i < BOOT_DIGEST_SIZE; i++)
+        diff |= a[i] ^ b[i];
+    return diff == 0;
+}
+
+static boot_status_t BootVerify(const boot_desc_t *desc)
+{
+    uint8_t digest[BOOT_DIGEST_SIZE];
+    const uint32_t *vectors = (const uint32_t *)BOOT_APP_BASE;
+    hash_ctx_t c;
+    bool hmac;
+
+    if (desc->magic != BOOT_MAGIC)
+        return BOOT_NO_DESCRIPTOR;
+    if (desc->length < 8 || desc->length > BOOT_APP_MAX)
+        return BOOT_BAD_LENGTH;
+
+    hmac = (desc->flags & BOOT_FLAG_HMAC) != 0;
+    if (hmac != BOOT_SIGNED)
+        return BOOT_WRONG_KIND;
+
+    if (hmac)
+        HASH_hmac_init(&c, HASH_SHA256, bootKey, BOOT_KEY_SIZE);
+    else
+        HASH_init(&c, HASH_SHA256);
+    HashFlash(&c, BOOT_APP_BASE, desc->length);
+    HASH_update(&c, desc, BOOT_DESC_SIGNED);
+    HASH_final(&c, digest);
+
+    if (!DigestEqual(digest, desc->digest))
+        return BOOT_BAD_DIGEST;
+
+    // Initial stack pointer in SRAM, reset handler a Thumb address in the
+    // image
+    if (vectors[0] <= SRAM_BASE || vectors[0] > SRAM_BASE + SRAM_SIZE ||
+        (vectors[1] & 1) == 0 || vectors[1] < BOOT_APP_BASE ||
+        vectors[1] >= BOOT_APP_BASE + desc->length)
+        return BOOT_BAD_VECTORS;
+
+    return BOOT_OK;
+}
+
+// Clears all of SRAM, this function's own stack included, then loads the
+// stack pointer from the image's vector table and branches to its reset
+// handler. Nothing after the clear touches memory, and r2-r12 are left
+// zero. The bounds are SRAM_BASE and SRAM_BASE + SRAM_SIZE. ui32Base
+// arrives in r0, as in driverlib/cpu.c.
+#pragma FUNC_CANNOT_INLINE(BootJump)
+void BootJump(uint32_t ui32Base)
+{
+    __asm("    movs    r1, #0\n"
+          "    movw    r2, #0x0000\n"
+          "    movt    r2, #0x2000\n"
+          "    movw    r3, #0x8000\n"
+          "    movt    r3, #0x2000\n"
+          "BootJumpClear:\n"
+          "    str     r1, [r2], #4\n"
+          "    cmp     r2, r3\n"
+          "    bne     BootJumpClear\n"
+          "    mov     r2, r1\n"
+          "    mov     r3, r1\n"
+          "    mov     r4, r1\n"
+          "    mov     r5, r1\n"
+          "    mov     r6, r1\n"
+          "    mov     r7, r1\n"
+          "    mov     r8, r1\n"
+          "    mov     r9, r1\n"
+          "    mov     r10, r1\n"
+          "    mov     r11, r1\n"
+          "    mov     r12, r1\n"
+          "    ldr     r1, [r0]\n"
+          "    msr     msp, r1\n"
+          "    ldr     r1, [r0, #4]\n"
+          "    bx      r1\n");
+}
+
+// Leaves the part as the application would find it after reset, except for
+// the hidden key block, and starts it
+static void BootStartApp(void)
+{
+    while (UARTBusy(UART0_BASE));
+    SysCtlPeripheralReset(SYSCTL_PERIPH_UART0);
+    SysCtlPeripheralReset(SYSCTL_PERIPH_GPIOA);
+    SysCtlPeripheralDisable(SYSCTL_PERIPH_UART0);
+    SysCtlPeripheralDisable(SYSCTL_PERIPH_GPIOA);
+    HWREG(DWT_CTRL) &= ~1;
+    HWREG(DEMCR) &= ~DEMCR_TRCENA;
+
+    // 16 MHz PIOSC, the clock out of reset
+    SysCtlClockSet(SYSCTL_SYSDIV_1 | SYSCTL_USE_OSC | SYSCTL_OSC_INT |
+                   SYSCTL_XTAL_16MHZ);
+
+    // Not saved to the non-volatile registers, so it lasts until reset
+    FlashProtectSet(BOOT_KEY_ADDR, FlashExecuteOnly);
+
+    HWREG(NVIC_VTABLE) = BOOT_APP_BASE;
+    BootJump(BOOT_APP_BASE);
+}
+
+static void BootFail(void)
+{
+    SysCtlPeripheralEnable(SYSCTL_PERIPH_GPIOF);
+    GPIOPinTypeGPIOOutput(GPIO_PORTF_BASE, GPIO_PIN_1);
+
+    while(1)
+    {
+        GPIOPinWrite(GPIO_PORTF_BASE, GPIO_PIN_1,
+                     GPIOPinRead(GPIO_PORTF_BASE, GPIO_PIN_1) ^ GPIO_PIN_1);
+        SysCtlDelay(SysCtlClockGet() / 6);  // ~0.5 s
+    }
+}
+
+// Prints cycles as milliseconds with three decimals, and cycles per byte
+static void PrintTime(uint32_t cycles, uint32_t bytes)
+{
+    uint32_t perMs = SysCtlClockGet() / 1000;
+
+    UARTprintf("%d.%03d ms, %d cycles/byte", cycles / perMs,
+               (cycles % perMs) * 1000 / perMs, cycles / bytes);
+}
+
+int main(void)
+{
+    const boot_desc_t *desc = (const boot_desc_t *)BOOT_DESC_ADDR;
+    boot_status_t status;
+    uint32_t start, cycles;
+
+    // Run system clock at 80 MHz from PLL (16 MHz crystal / 400 MHz PLL / 2.5)
+    SysCtlClockSet(SYSCTL_SYSDIV_2_5 | SYSCTL_USE_PLL |
+                   SYSCTL_OSC_MAIN | SYSCTL_XTAL_16MHZ);
+
+    ConfigureUART();
+    HWREG(DEMCR) |= DEMCR_TRCENA;
+    HWREG(DWT_CTRL) |= 1;
+
+#if BOOT_BENCH
+    {
+        hash_ctx_t c;
+        uint8_t digest[BOOT_DIGEST_SIZE];
+
+        start = HWREG(DWT_CYCCNT);
+        HASH_init(&c, HASH_SHA256);
+        HashFlash(&c, 0, FLASH_SIZE);
+        HASH_final(&c, digest);
+        cycles = HWREG(DWT_CYCCNT) - start;
+        UARTprintf("boot: SHA-256 of 256 KB flash: ");
+        PrintTime(cycles, FLASH_SIZE);
+        UARTprintf("\n");
+    }
+#endif
+
+    start = HWREG(DWT_CYCCNT);
+    status = BootVerify(desc);
+    cycles = HWREG(DWT_CYCCNT) - start;
+
+    UARTprintf("boot: image %d bytes, version %d, %s: %s, ",
+               (status == BOOT_NO_DESCRIPTOR) ? 0 : desc->length,
+               (status == BOOT_NO_DESCRIPTOR) ? 0 : desc->version,
+               BOOT_SIGNED ? "HMAC-SHA-256" : "SHA-256", statusText[status]);
+    PrintTime(cycles, (status == BOOT_NO_DESCRIPTOR) ? 1 : desc->length);
+    UARTprintf("\n");
+
+    if (status != BOOT_OK)
+        BootFail();
+
+    BootStartApp();
+
+    return 0;
+}
@@ -0,0 +1,82 @@
+/******************************************************************************
+ *
+ * boot_ccs.cmd - CCS linker configuration file for boot.
+ *
+ * Copyright (c) 2012-2020 Texas Instruments Incorporated.  All rights reserved.
+ * Software License Agreement
+ * 
+ * Texas Instruments (TI) is supplying this software for use solely and
+ * exclusively on TI's microcontroller products. The software is owned by
+ * TI and/or its suppliers, and is protected under applicable copyright
+ * laws. You may not combine this software with "viral" open-source
+ * software in order to form a larger program.
+ * 
+ * THIS SOFTWARE IS PROVIDED "AS IS" AND WITH ALL FAULTS.
+ * NO WARRANTIES, WHETHER EXPRESS, IMPLIED OR STATUTORY, INCLUDING, BUT
+ * NOT LIMITED TO, IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE APPLY TO THIS SOFTWARE. TI SHALL NOT, UNDER ANY
+ * CIRCUMSTANCES, BE LIABLE FOR SPECIAL, INCIDENTAL, OR CONSEQUENTIAL
+ * DAMAGES, FOR ANY REASON WHATSOEVER.
+ * 
+ * This is part of revision 2.2.0.295 of the EK-TM4C123GXL Firmware Package.
+ *
+ *****************************************************************************/
+
+--retain=g_pfnVectors
+
+/* The following command line options are set as part of the CCS project.    */
+/* If you are building using the command line, or for some reason want to    */
+/* define them here, you can uncomment and modify these lines as needed.     */
+/* If you are using CCS for building, it is probably better to make any such */
+/* modifications in your CCS project and leave this file alone.              */
+/*                                                                           */
+/* --heap_size=0                                                             */
+/* --stack_size=256                                                          */
+/* --library=rtsv7M3_T_le_eabi.lib                                           */
+
+/* The starting address of the application.  Normally the interrupt vectors  */
+/* must be located at the beginning of the application.                      */
+/* The boot verifier runs from reset and owns the first 16 KB of flash; the   */
+/* application it starts is linked at BOOT_APP_BASE (see boot_image.h). The  */
+/* last 2 KB protection block holds only the key, so that it can be made     */
+/* execute-only without hiding any code or literals.                         */
+#define APP_BASE 0x00000000
+#define RAM_BASE 0x20000000
+
+/* System memory map */
+
+MEMORY
+{
+    /* Application stored in and executes from internal flash */
+    FLASH (RX) : origin = APP_BASE, length = 0x00003800
+    /* HMAC key, alone in its protection block (BOOT_KEY_ADDR) */
+    BOOTKEY (R) : origin = 0x00003800, length = 0x00000800
+    /* Application uses internal RAM for data */
+    SRAM (RWX) : origin = 0x20000000, length = 0x00008000
+}
+
+/* Section allocation in memory */
+
+SECTIONS
+{
+    .intvecs:   > APP_BASE
+    .text   :   > FLASH
+    .const  :   > FLASH
+    .cinit  :   > FLASH
+    .pinit  :   > FLASH
+    .init_array : > FLASH
+    .bootkey :  > BOOTKEY
+
+    .vtable :   > RAM_BASE
+    .data   :   > SRAM
+    .bss    :   > SRAM
+    .sysmem :   > SRAM
+    .stack  :   > SRAM
+#ifdef  __TI_COMPILER_VERSION__
+#if     __TI_COMPILER_VERSION__ >= 15009000
+    .TI.ramfunc : {} load=FLASH, run=SRAM, table(BINIT)
+#endif
+#endif
+}
+
+__STACK_TOP = __stack + 2048;
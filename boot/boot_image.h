@@ -0,0 +1,54 @@
+/******************************************************************************
+ * Project  : Boot-time image verifier
+ * File     : boot_image.h
+ *
+ * Description:
+ *   Flash layout shared by the boot verifier and image_sign.py.
+ *
+ *     0x00000000  boot (16 KB): verifier code; its HMAC key sits alone in
+ *                 the last 2 KB protection block, 0x00003800
+ *     0x00004000  application, linked with APP_BASE 0x00004000
+ *     0x0003FC00  image descriptor (last 1 KB erase page)
+ *
+ *   The descriptor gives the image length and its digest: SHA-256, or
+ *   HMAC-SHA-256 under the boot key, of the image bytes followed by the
+ *   first 16 bytes of the descriptor itself, so the length and flags cannot
+ *   be changed without breaking the digest.
+ *
+ * Author   : Jithin B.P.
+ * Affiliation: CSpark Research
+ * Email    : jithinuser@gmail.com
+ *
+ * License  : This source code is released under an open-source license.
+ *            You may use, modify, and distribute it freely, provided that
+ *            proper attribution is given to the original author.
+ *
+ * Created  : 2025
+ ******************************************************************************/
+#ifndef BOOT_IMAGE_H
+#define BOOT_IMAGE_H
+
+#include <stdint.h>
+
+#define BOOT_KEY_ADDR       0x00003800
+#define BOOT_APP_BASE       0x00004000
+#define BOOT_DESC_ADDR      0x0003FC00
+#define BOOT_APP_MAX        (BOOT_DESC_ADDR - BOOT_APP_BASE)
+
+#define BOOT_MAGIC          0x544F4F42  // "BOOT"
+#define BOOT_FLAG_HMAC      0x00000001  // Digest is HMAC-SHA-256, not SHA-256
+#define BOOT_DIGEST_SIZE    32
+#define BOOT_KEY_SIZE       32
+
+// Little-endian, as written by image_sign.py
+typedef struct {
+    uint32_t magic;
+    uint32_t length;                    // Image bytes from BOOT_APP_BASE
+    uint32_t flags;
+    uint32_t version;                   // Free for the application's use
+    uint8_t digest[BOOT_DIGEST_SIZE];
+} boot_desc_t;
+
+#define BOOT_DESC_SIGNED    16          // Descriptor bytes covered by the digest
+
+#endif // BOOT_IMAGE_H
@@ -0,0 +1,87 @@
+#!/usr/bin/env python3
+#
+# image_sign.py - makes a flashable, verifiable image for the boot project.
+#
+# Reads an application .bin linked at BOOT_APP_BASE (0x00004000) and writes
+# one .bin to program at that address: the application, 0xFF up to the
+# descriptor page at BOOT_DESC_ADDR, then the descriptor (see boot_image.h).
+#
+# With --key the digest is HMAC-SHA-256 under the 32-byte key in that file
+# (raw bytes, or 64 hex digits), as boot.c requires with BOOT_SIGNED set;
+# without it the digest is a plain SHA-256.
+#
+# Usage: image_sign.py [--key key.bin] [--version N] <app.bin> <out.bin>
+#
+# Author   : Jithin B.P.
+# Affiliation: CSpark Research
+# Email    : jithinuser@gmail.com
+#
+# License  : This source code is released under an open-source license.
+#            You may use, modify, and distribute it freely, provided that
+#            proper attribution is given to the original author.
+#
+# Created  : 2025
+
+import argparse
+import hashlib
+import hmac
+import struct
+import sys
+
+BOOT_APP_BASE = 0x00004000
+BOOT_DESC_ADDR = 0x0003FC00
+BOOT_APP_MAX = BOOT_DESC_ADDR - BOOT_APP_BASE
+BOOT_MAGIC = 0x544F4F42
+BOOT_FLAG_HMAC = 0x00000001
+BOOT_KEY_SIZE = 32
+
+
+def read_key(path):
+    with open(path, 'rb') as f:
+        key = f.read()
+    if len(key) != BOOT_KEY_SIZE:
+        try:
+            key = bytes.fromhex(key.decode('ascii').strip())
+        except ValueError:
+            pass
+    if len(key) != BOOT_KEY_SIZE:
+        sys.exit('%s: key must be %d bytes or %d hex digits'
+                 % (path, BOOT_KEY_SIZE, 2 * BOOT_KEY_SIZE))
+    return key
+
+
+def main():
+    ap = argparse.ArgumentParser(description='Sign an image for boot.c')
+    ap.add_argument('--key', help='HMAC key file; omit for plain SHA-256')
+    ap.add_argument('--version', type=int, default=0)
+    ap.add_argument('app')
+    ap.add_argument('out')
+    args = ap.parse_args()
+
+    with open(args.app, 'rb') as f:
+        image = f.read()
+    if len(image) < 8 or len(image) > BOOT_APP_MAX:
+        sys.exit('%s: %d bytes; the application region holds %d'
+                 % (args.app, len(image), BOOT_APP_MAX))
+
+    flags = BOOT_FLAG_HMAC if args.key else 0
+    header = struct.pack('<4I', BOOT_MAGIC, len(image), flags,
+                         args.version & 0xFFFFFFFF)
+    if args.key:
+        digest = hmac.new(read_key(args.key), image + header,
+                          hashlib.sha256).digest()
+    else:
+        digest = hashlib.sha256(image + header).digest()
+
+    with open(args.out, 'wb') as f:
+        f.write(image)
+        f.write(b'\xff' * (BOOT_APP_MAX - len(image)))
+        f.write(header + digest)
+
+    print('%s: %d bytes, %s %s' % (args.out, len(image),
+                                   'HMAC-SHA-256' if args.key else 'SHA-256',
+                                   digest.hex()))
+
+
+if __name__ == '__main__':
+    main()
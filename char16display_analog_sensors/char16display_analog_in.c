@@ -18,7 +18,6 @@
  ******************************************************************************/
 //https://deepbluembedded.com/lcd-custom-character-arduino/
 
-#include <stdio.h>
 #include <stdint.h>
 #include <stdbool.h>
 #include "inc/hw_memmap.h"
@@ -27,6 +26,7 @@
 #include "driverlib/gpio.h"
 #include "driverlib/timer.h"
 #include "driverlib/adc.h"
+#include "../utils/fmt.h"
 
 void ADCSeq0Handler(void) {}
 
@@ -123,11 +123,19 @@ void LCD_print(char *s) {
     }
 }
 
+// LCD as a formatter sink: FMT_PRINT(&lcd_sink, ...)
+static void LCD_put(fmt_sink_t *sink, const char *s, uint32_t len) {
+    while(len--) {
+        LCD_data(*s++);
+    }
+}
+
+fmt_sink_t lcd_sink = { LCD_put };
+
 
 // ------------ Main ------------
 int main(void) {
     uint32_t adcValue;
-    char buffer[10];
 
     // 40 MHz clock
     SysCtlClockSet(SYSCTL_SYSDIV_5 | SYSCTL_USE_PLL |
@@ -174,8 +182,7 @@ int main(void) {
 
         LCD_setCursor(2,0);
         // show result
-        snprintf(buffer, 11, "V: %3d ", adcValue);
-        LCD_print(buffer);
+        FMT_PRINT(&lcd_sink, FMT_S("V: "), FMT_U(adcValue, 3), FMT_S(" "));
 
         delay_ms(500);
     }
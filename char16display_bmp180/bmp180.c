@@ -0,0 +1,190 @@
+/******************************************************************************
+ * Project  : 16 character LCD display for BMP180 readings
+ * File     : bmp180.c
+ *
+ * Description:
+ * BMP180 barometric sensor driver. See bmp180.h.
+ *
+ * Author   : Jithin B.P.
+ * Affiliation: CSpark Research
+ * Email    : jithinuser@gmail.com
+ *
+ * License  : This source code is released under an open-source license.
+ * You may use, modify, and distribute it freely, provided that
+ * proper attribution is given to the original author.
+ *
+ * Created  : 2025
+ ******************************************************************************/
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "bmp180.h"
+
+bmp180_calib_data_t calib;
+
+// Global B5 value for pressure calculation (calculated during temperature compensation)
+int32_t B5;
+
+// Max conversion time per OSS in us (datasheet 4.5/7.5/13.5/25.5 ms, rounded up)
+static const uint16_t bmp180_conv_us[BMP180_OSS_MAX + 1] = {5000, 8000, 14000, 26000};
+#define BMP180_TEMP_CONV_US 5000
+
+// RMS pressure noise per OSS in 0.1 Pa units (datasheet: 0.06/0.05/0.04/0.03 hPa)
+static const uint8_t bmp180_noise_dPa[BMP180_OSS_MAX + 1] = {60, 50, 40, 30};
+
+// Noise reduction of the IIR stage for alpha = 1/2^k, sqrt(alpha / (2 - alpha)), x1000
+static const uint16_t bmp180_iir_gain[BMP180_IIR_MAX_SHIFT + 1] = {1000, 577, 378, 258, 180};
+
+// Runtime measurement settings, chosen by BMP180_configure()
+uint8_t  bmp180_oss = BMP180_OSS_DEFAULT;
+uint8_t  bmp180_iir_shift = 0;         // 0 = smoothing off
+uint32_t bmp180_period_us = 1000000;   // Time between pressure samples
+uint32_t bmp180_temp_every = 1;        // Pressure samples per temperature refresh
+uint32_t bmp180_bus_hz = 100000;       // SCL rate, for bus time estimates
+
+// IIR filter state, pressure in Pa with 4 fractional bits
+int32_t bmp180_p_filt;
+bool bmp180_p_filt_valid = false;
+
+// Reads 2 bytes (MSB, LSB) from the BMP180
+int16_t I2C_read_int16(uint8_t reg) {
+    uint8_t data[2] = {0, 0};
+    I2C_read_multiple(reg, 2, data);
+    // BMP180 is big-endian: MSB is first
+    return (int16_t)((data[0] << 8) | data[1]);
+}
+
+// Reads 3 bytes (MSB, LSB, XLSB) for uncompensated pressure
+uint32_t I2C_read_UP(uint8_t reg) {
+    uint8_t data[3] = {0, 0, 0};
+    I2C_read_multiple(reg, 3, data);
+    // UP is 19-bit value: (MSB << 16) | (LSB << 8) | (XLSB) >> (8 - OSS)
+    return (uint32_t)(((data[0] << 16) | (data[1] << 8) | data[2]) >> (8 - bmp180_oss));
+}
+
+void BMP180_read_calib_data(void) {
+    uint8_t buffer[22];
+    
+    // Read 22 bytes starting from 0xAA (AC1_MSB)
+    I2C_read_multiple(REG_CALIB_START, 22, buffer);
+
+    // Parse the big-endian data into the structure (11 x 16-bit values)
+    calib.AC1 = (buffer[0] << 8) | buffer[1];
+    calib.AC2 = (buffer[2] << 8) | buffer[3];
+    calib.AC3 = (buffer[4] << 8) | buffer[5];
+    calib.AC4 = (buffer[6] << 8) | buffer[7];
+    calib.AC5 = (buffer[8] << 8) | buffer[9];
+    calib.AC6 = (buffer[10] << 8) | buffer[11];
+    calib.B1  = (buffer[12] << 8) | buffer[13];
+    calib.B2  = (buffer[14] << 8) | buffer[15];
+    calib.MB  = (buffer[16] << 8) | buffer[17];
+    calib.MC  = (buffer[18] << 8) | buffer[19];
+    calib.MD  = (buffer[20] << 8) | buffer[21];
+}
+
+// Reads uncompensated temperature (UT)
+int32_t BMP180_read_UT(void) {
+    I2C_write(REG_CONTROL, CMD_READ_TEMP);
+    delay_us(BMP180_TEMP_CONV_US); // Wait 4.5ms for conversion
+    return I2C_read_int16(REG_MSB);
+}
+
+// Reads uncompensated pressure (UP)
+int32_t BMP180_read_UP(void) {
+    I2C_write(REG_CONTROL, CMD_READ_PRESSURE(bmp180_oss));
+    // Wait time depends on OSS setting
+    // OSS=0: 4.5ms, OSS=1: 7.5ms, OSS=2: 13.5ms, OSS=3: 25.5ms
+    delay_us(bmp180_conv_us[bmp180_oss]);
+    return I2C_read_UP(REG_MSB);
+}
+
+// Picks OSS, IIR strength and temperature refresh interval for a requested
+// output rate (Hz) and RMS pressure noise target (0.1 Pa units, 0 = no target).
+// The highest OSS whose conversion fits the sample period is used, and the IIR
+// stage is strengthened until the filtered noise meets the target, so a fast
+// OSS0/OSS1 stream can still match OSS3 noise.
+void BMP180_configure(uint32_t rate_hz, uint32_t noise_dPa) {
+    uint32_t temp_cost_us, bus_us;
+    uint8_t oss, k;
+
+    if (rate_hz == 0) rate_hz = 1;
+    bmp180_period_us = 1000000 / rate_hz;
+
+    // Temperature drifts slowly: refresh it about once per second
+    bmp180_temp_every = rate_hz;
+    bus_us = BMP180_BUS_BITS * 1000000 / bmp180_bus_hz;
+    temp_cost_us = (BMP180_TEMP_CONV_US + bus_us) / bmp180_temp_every;
+
+    for (oss = BMP180_OSS_MAX; oss > 0; oss--) {
+        if (bmp180_conv_us[oss] + bus_us + temp_cost_us <= bmp180_period_us)
+            break;
+    }
+    bmp180_oss = oss;
+
+    k = 0;
+    if (noise_dPa != 0) {
+        while (k < BMP180_IIR_MAX_SHIFT &&
+               (uint32_t)bmp180_noise_dPa[oss] * bmp180_iir_gain[k] > noise_dPa * 1000)
+            k++;
+    }
+    bmp180_iir_shift = k;
+    bmp180_p_filt_valid = false;
+}
+
+// First-order IIR smoothing, p += (in - p) / 2^k, in integer arithmetic
+float BMP180_filter_pressure(float pressure) {
+    int32_t p = (int32_t)(pressure * 16.0f);
+
+    if (!bmp180_p_filt_valid || bmp180_iir_shift == 0) {
+        bmp180_p_filt = p;
+        bmp180_p_filt_valid = true;
+    } else {
+        bmp180_p_filt += (p - bmp180_p_filt) >> bmp180_iir_shift;
+    }
+    return (float)bmp180_p_filt / 16.0f;
+}
+
+// BMP180 Compensation Algorithm (Calculates B5, Temp, and Pressure)
+// Reference: BMP180 datasheet. Integer steps exactly as there: each / 2^n is an
+// arithmetic shift, so results match the datasheet example to the pascal.
+void BMP180_compensate(int32_t UT, int32_t UP, float *temperature, float *pressure) {
+    int32_t X1, X2, X3, B3, B6, P;
+    uint32_t B4, B7;
+    int32_t T;
+
+    // ----------------- Step 1: Calculate B5 & True Temperature -----------------
+    X1 = (((int32_t)UT - calib.AC6) * calib.AC5) >> 15;
+    X2 = ((int32_t)calib.MC * 2048) / (X1 + calib.MD);
+    B5 = X1 + X2;
+    
+    T = (B5 + 8) >> 4;
+    *temperature = (float)T / 10.0f; // Temperature in degrees C
+
+    // ----------------- Step 2: Calculate True Pressure -----------------
+    B6 = B5 - 4000;
+    X1 = (calib.B2 * ((B6 * B6) >> 12)) >> 11;
+    X2 = (calib.AC2 * B6) >> 11;
+    X3 = X1 + X2;
+
+    B3 = ((((int32_t)calib.AC1 * 4 + X3) << bmp180_oss) + 2) / 4;
+    
+    X1 = (calib.AC3 * B6) >> 13;
+    X2 = (calib.B1 * ((B6 * B6) >> 12)) >> 16;
+    X3 = ((X1 + X2) + 2) >> 2;
+
+    B4 = ((uint32_t)calib.AC4 * (uint32_t)(X3 + 32768)) >> 15;
+
+    B7 = ((uint32_t)UP - B3) * (50000 >> bmp180_oss);
+
+    if (B7 < 0x80000000) {
+        P = (B7 * 2) / B4;
+    } else {
+        P = (B7 / B4) * 2;
+    }
+
+    X1 = (P >> 8) * (P >> 8);
+    X1 = (X1 * 3038) >> 16;
+    X2 = (-7357 * P) >> 16;
+
+    *pressure = (float)(P + ((X1 + X2 + 3791) >> 4)); // Pressure in Pa
+}
@@ -0,0 +1,90 @@
+/******************************************************************************
+ * Project  : 16 character LCD display for BMP180 readings
+ * File     : bmp180.h
+ *
+ * Description:
+ * BMP180 barometric sensor driver: calibration, runtime oversampling
+ * selection, pressure smoothing and the datasheet compensation algorithm.
+ * It only needs the register helpers below, so the same code runs on the
+ * LaunchPad (over i2c_bus.c) and in the host-side simulator (bmp180_sim/).
+ *
+ * Author   : Jithin B.P.
+ * Affiliation: CSpark Research
+ * Email    : jithinuser@gmail.com
+ *
+ * License  : This source code is released under an open-source license.
+ * You may use, modify, and distribute it freely, provided that
+ * proper attribution is given to the original author.
+ *
+ * Created  : 2025
+ ******************************************************************************/
+
+#ifndef BMP180_H
+#define BMP180_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+// ------------ BMP180 Definitions ------------
+#define BMP180_I2C_ADDRESS  0x77
+#define BMP180_OSS_DEFAULT  3           // Oversampling setting (0 to 3) used before BMP180_configure()
+#define BMP180_OSS_MAX      3
+#define BMP180_IIR_MAX_SHIFT 4          // Strongest pressure smoothing: alpha = 1/16
+
+
+// Approx. SCL clocks for one command write + 2/3 byte read (addressing included)
+#define BMP180_BUS_BITS     100
+
+// Register addresses
+#define REG_CALIB_START     0xAA
+#define REG_CONTROL         0xF4
+#define REG_MSB             0xF6
+#define REG_LSB             0xF7
+#define REG_XLSB            0xF8
+
+// Control register commands
+#define CMD_READ_TEMP       0x2E
+#define CMD_READ_PRESSURE(oss) (0x34 + ((oss) << 6))
+
+// Structure to hold 11 calibration coefficients
+typedef struct {
+    int16_t AC1;
+    int16_t AC2;
+    int16_t AC3;
+    uint16_t AC4;
+    uint16_t AC5;
+    uint16_t AC6;
+    int16_t B1;
+    int16_t B2;
+    int16_t MB;
+    int16_t MC;
+    int16_t MD;
+} bmp180_calib_data_t;
+
+
+// Calibration coefficients and the B5 term shared by T and P compensation
+extern bmp180_calib_data_t calib;
+extern int32_t B5;
+
+// Runtime measurement settings, chosen by BMP180_configure()
+extern uint8_t  bmp180_oss;
+extern uint8_t  bmp180_iir_shift;
+extern uint32_t bmp180_period_us;
+extern uint32_t bmp180_temp_every;
+extern uint32_t bmp180_bus_hz;
+
+// Provided by the platform: register write/read (0 = success) and a delay
+uint32_t I2C_write(uint8_t reg, uint8_t data);
+uint32_t I2C_read_multiple(uint8_t reg, uint8_t count, uint8_t *data);
+void delay_us(uint32_t us);
+
+int16_t I2C_read_int16(uint8_t reg);
+uint32_t I2C_read_UP(uint8_t reg);
+void BMP180_read_calib_data(void);
+int32_t BMP180_read_UT(void);
+int32_t BMP180_read_UP(void);
+void BMP180_configure(uint32_t rate_hz, uint32_t noise_dPa);
+float BMP180_filter_pressure(float pressure);
+void BMP180_compensate(int32_t UT, int32_t UP, float *temperature, float *pressure);
+
+#endif // BMP180_H
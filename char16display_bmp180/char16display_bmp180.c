@@ -22,18 +22,24 @@
  * Created  : 2025
  ******************************************************************************/
 
-#include <stdio.h>
 #include <stdint.h>
 #include <stdbool.h>
 #include <string.h>
 #include <math.h> // Required for floating point math
+#include <time.h> // struct tm, used by hibernate.h
 #include "inc/hw_memmap.h"
 #include "inc/hw_types.h"
 #include "driverlib/sysctl.h"
 #include "driverlib/gpio.h"
 #include "driverlib/i2c.h" // New header for I2C
+#include "driverlib/interrupt.h"
+#include "driverlib/hibernate.h" // Battery-backed memory for the calibration cache
+#include "driverlib/sw_crc.h"
 #include "driverlib/pin_map.h"
 #include "driverlib/adc.h" // Keeping original headers just in case, but ADC is not used
+#include "i2c_bus.h"        // Shared I2C0 bus manager (I2C0Handler lives there)
+#include "bmp180.h"         // BMP180 driver (calibration, OSS selection, compensation)
+#include "../utils/fmt.h"   // Type-checked formatter (no snprintf/float printf)
 
 void ADCSeq0Handler(void) {}
 
@@ -47,47 +53,37 @@ void ADCSeq0Handler(void) {}
 #define LCD_DMASK   (GPIO_PIN_0 | GPIO_PIN_1 | GPIO_PIN_2 | GPIO_PIN_3)
 
 // ------------ BMP180 I2C Definitions ------------
-#define BMP180_I2C_ADDRESS  0x77
-#define BMP180_BASE         I2C0_BASE
-#define BMP180_OSS          3           // Oversampling setting (0 to 3)
-
-// Register addresses
-#define REG_CALIB_START     0xAA
-#define REG_CONTROL         0xF4
-#define REG_MSB             0xF6
-#define REG_LSB             0xF7
-#define REG_XLSB            0xF8
-
-// Control register commands
-#define CMD_READ_TEMP       0x2E
-#define CMD_READ_PRESSURE   (0x34 + (BMP180_OSS << 6))
-
-// Structure to hold 11 calibration coefficients
-typedef struct {
-    int16_t AC1;
-    int16_t AC2;
-    int16_t AC3;
-    uint16_t AC4;
-    uint16_t AC5;
-    uint16_t AC6;
-    int16_t B1;
-    int16_t B2;
-    int16_t MB;
-    int16_t MC;
-    int16_t MD;
-} bmp180_calib_data_t;
-
-bmp180_calib_data_t calib;
-
-// Global B5 value for pressure calculation (calculated during temperature compensation)
-int32_t B5;
+#define BMP180_I2C_SPEED    I2C_SPEED_FAST
+#define BMP180_PRIORITY     1           // 0 is reserved for latency-critical devices
+
+// Requested output rate and RMS pressure noise target (0.1 Pa units).
+// 30 = 3 Pa, the datasheet noise of OSS3 (ultra high resolution).
+#define BMP180_RATE_HZ      50
+#define BMP180_NOISE_DPA    30
+
+// Cycle counter, for the fixed sample period
+#define DEMCR               0xE000EDFC
+#define DEMCR_TRCENA        0x01000000
+#define DWT_CTRL            0xE0001000
+#define DWT_CYCCNT          0xE0001004
+
+// Calibration cache in the hibernation module's battery-backed data registers:
+// 6 words of coefficients, a tag word and a CRC-32 over the first 7 words
+#define CALIB_CACHE_WORDS   8
+#define CALIB_CACHE_TAG     (0xB1800000 | sizeof(bmp180_calib_data_t))
+
+// The BMP180 as seen by the bus manager
+const i2c_device_t bmp180_dev = {BMP180_I2C_ADDRESS, BMP180_I2C_SPEED, BMP180_PRIORITY};
 
 // --- Small delay helpers ---
 void delay_ms(uint32_t ms) {
     SysCtlDelay((SysCtlClockGet()/3000) * ms); // approx ms
 }
 void delay_us(uint32_t us) {
-    SysCtlDelay((SysCtlClockGet()/3000000) * us); // approx us
+    // 3 cycles per SysCtlDelay() loop, rounded up so a delay is never short
+    // (40 MHz would otherwise give 13 loops per us, 2.5% short)
+    uint32_t loops = ((SysCtlClockGet()/1000000) * us + 2) / 3;
+    if (loops) SysCtlDelay(loops);
 }
 
 // ===============================================
@@ -167,187 +163,76 @@ void LCD_print(char *s) {
     }
 }
 
+// LCD as a formatter sink: FMT_PRINT(&lcd_sink, ...)
+static void LCD_put(fmt_sink_t *sink, const char *s, uint32_t len) {
+    while(len--) {
+        LCD_data(*s++);
+    }
+}
+
+fmt_sink_t lcd_sink = { LCD_put };
+
 // ===============================================
 //          I2C Functions (New)
 // ===============================================
 
 // Generic function to write a command to a register
-void I2C_write(uint8_t reg, uint8_t data) {
-    // Specify the slave address
-    I2CMasterSlaveAddrSet(BMP180_BASE, BMP180_I2C_ADDRESS, false); 
-    
-    // Tell the master to write the register address
-    I2CMasterDataPut(BMP180_BASE, reg);
-    I2CMasterControl(BMP180_BASE, I2C_MASTER_CMD_BURST_SEND_START);
-    while(I2CMasterBusy(BMP180_BASE));
-
-    // Send the data
-    I2CMasterDataPut(BMP180_BASE, data);
-    I2CMasterControl(BMP180_BASE, I2C_MASTER_CMD_BURST_SEND_FINISH);
-    while(I2CMasterBusy(BMP180_BASE));
+uint32_t I2C_write(uint8_t reg, uint8_t data) {
+    return I2C_transfer(&bmp180_dev, reg, &data, 1, 0, 0);
 }
 
 // Generic function to read one or more bytes starting from a register
 uint32_t I2C_read_multiple(uint8_t reg, uint8_t count, uint8_t *data) {
-    if (count == 0) return 0;
-    
-    // 1. Send register address (write mode)
-    I2CMasterSlaveAddrSet(BMP180_BASE, BMP180_I2C_ADDRESS, false); // false = transmit
-    I2CMasterDataPut(BMP180_BASE, reg);
-    I2CMasterControl(BMP180_BASE, I2C_MASTER_CMD_SINGLE_SEND);
-    while(I2CMasterBusy(BMP180_BASE));
-
-    // 2. Switch to read mode
-    I2CMasterSlaveAddrSet(BMP180_BASE, BMP180_I2C_ADDRESS, true); // true = receive
-
-    if (count == 1) {
-        // Single byte read
-        I2CMasterControl(BMP180_BASE, I2C_MASTER_CMD_SINGLE_RECEIVE);
-        while(I2CMasterBusy(BMP180_BASE));
-        *data = I2CMasterDataGet(BMP180_BASE);
-        return 1;
-    } else {
-        // Multi-byte read (first byte needs special start command)
-        I2CMasterControl(BMP180_BASE, I2C_MASTER_CMD_BURST_RECEIVE_START);
-        while(I2CMasterBusy(BMP180_BASE));
-        *data++ = I2CMasterDataGet(BMP180_BASE);
-        count--;
-
-        while (count > 1) {
-            // Middle bytes (continue)
-            I2CMasterControl(BMP180_BASE, I2C_MASTER_CMD_BURST_RECEIVE_CONT);
-            while(I2CMasterBusy(BMP180_BASE));
-            *data++ = I2CMasterDataGet(BMP180_BASE);
-            count--;
-        }
-        
-        // Last byte (finish)
-        I2CMasterControl(BMP180_BASE, I2C_MASTER_CMD_BURST_RECEIVE_FINISH);
-        while(I2CMasterBusy(BMP180_BASE));
-        *data = I2CMasterDataGet(BMP180_BASE);
-        return 1; // Success
-    }
-}
-
-// Reads 2 bytes (MSB, LSB) from the BMP180
-int16_t I2C_read_int16(uint8_t reg) {
-    uint8_t data[2];
-    I2C_read_multiple(reg, 2, data);
-    // BMP180 is big-endian: MSB is first
-    return (int16_t)((data[0] << 8) | data[1]);
-}
-
-// Reads 3 bytes (MSB, LSB, XLSB) for uncompensated pressure
-uint32_t I2C_read_UP(uint8_t reg) {
-    uint8_t data[3];
-    I2C_read_multiple(reg, 3, data);
-    // UP is 19-bit value: (MSB << 16) | (LSB << 8) | (XLSB) >> (8 - OSS)
-    return (uint32_t)(((data[0] << 16) | (data[1] << 8) | data[2]) >> (8 - BMP180_OSS));
+    if (count == 0) return I2C_MASTER_ERR_NONE;
+    return I2C_transfer(&bmp180_dev, reg, 0, 0, data, count);
 }
 
 void I2C_init(void) {
-    // Enable I2C0 and GPIOB peripherals
-    SysCtlPeripheralEnable(SYSCTL_PERIPH_I2C0);
-    SysCtlPeripheralEnable(SYSCTL_PERIPH_GPIOB);
-    
-    // Wait for the peripherals to be ready
-    while(!SysCtlPeripheralReady(SYSCTL_PERIPH_I2C0));
-    while(!SysCtlPeripheralReady(SYSCTL_PERIPH_GPIOB));
-
-    // PB2 (SCL), PB3 (SDA)
-    GPIOPinConfigure(GPIO_PB2_I2C0SCL);
-    GPIOPinConfigure(GPIO_PB3_I2C0SDA);
-    
-    // Set PB2 and PB3 for I2C function
-    GPIOPinTypeI2CSCL(GPIO_PORTB_BASE, GPIO_PIN_2);
-    GPIOPinTypeI2C(GPIO_PORTB_BASE, GPIO_PIN_3);
-    
-    // Initialize I2C0 master module
-    I2CMasterInitExpClk(BMP180_BASE, SysCtlClockGet(), false); // false = 100kbps (standard mode)
+    // PB2/PB3 pin setup, interrupts and bus recovery are done by the manager
+    I2C_bus_init();
 }
 
 // ===============================================
 //          BMP180 Logic (New)
 // ===============================================
 
-void BMP180_read_calib_data(void) {
-    uint8_t buffer[22];
-    
-    // Read 22 bytes starting from 0xAA (AC1_MSB)
-    I2C_read_multiple(REG_CALIB_START, 22, buffer);
-
-    // Parse the big-endian data into the structure (11 x 16-bit values)
-    calib.AC1 = (buffer[0] << 8) | buffer[1];
-    calib.AC2 = (buffer[2] << 8) | buffer[3];
-    calib.AC3 = (buffer[4] << 8) | buffer[5];
-    calib.AC4 = (buffer[6] << 8) | buffer[7];
-    calib.AC5 = (buffer[8] << 8) | buffer[9];
-    calib.AC6 = (buffer[10] << 8) | buffer[11];
-    calib.B1  = (buffer[12] << 8) | buffer[13];
-    calib.B2  = (buffer[14] << 8) | buffer[15];
-    calib.MB  = (buffer[16] << 8) | buffer[17];
-    calib.MC  = (buffer[18] << 8) | buffer[19];
-    calib.MD  = (buffer[20] << 8) | buffer[21];
-}
+// Restores calib from hibernation memory. Returns false if the cache is empty,
+// was written by another layout, or fails its CRC.
+bool BMP180_calib_cache_load(void) {
+    uint32_t words[CALIB_CACHE_WORDS];
 
-// Reads uncompensated temperature (UT)
-int32_t BMP180_read_UT(void) {
-    I2C_write(REG_CONTROL, CMD_READ_TEMP);
-    delay_ms(5); // Wait 4.5ms for conversion
-    return I2C_read_int16(REG_MSB);
-}
+    HibernateDataGet(words, CALIB_CACHE_WORDS);
+    if (words[6] != CALIB_CACHE_TAG) return false;
+    if (Crc32(0xFFFFFFFF, (uint8_t *)words, 7 * 4) != words[7]) return false;
 
-// Reads uncompensated pressure (UP)
-int32_t BMP180_read_UP(void) {
-    I2C_write(REG_CONTROL, CMD_READ_PRESSURE);
-    // Wait time depends on OSS setting
-    // OSS=0: 4.5ms, OSS=1: 7.5ms, OSS=2: 13.5ms, OSS=3: 25.5ms
-    delay_ms(28); 
-    return I2C_read_UP(REG_MSB);
+    memcpy(&calib, words, sizeof(calib));
+    return true;
 }
 
-// BMP180 Compensation Algorithm (Calculates B5, Temp, and Pressure)
-// Reference: BMP180 datasheet
-void BMP180_compensate(int32_t UT, int32_t UP, float *temperature, float *pressure) {
-    int32_t X1, X2, X3, B3, B6, P;
-    uint32_t B4, B7;
-    int32_t T;
-
-    // ----------------- Step 1: Calculate B5 & True Temperature -----------------
-    X1 = ((int32_t)UT - calib.AC6) * calib.AC5 / pow(2, 15);
-    X2 = ((int32_t)calib.MC * pow(2, 11)) / (X1 + calib.MD);
-    B5 = X1 + X2;
-    
-    T = (B5 + 8) / pow(2, 4);
-    *temperature = (float)T / 10.0f; // Temperature in degrees C
-
-    // ----------------- Step 2: Calculate True Pressure -----------------
-    B6 = B5 - 4000;
-    X1 = (calib.B2 * (B6 * B6 / pow(2, 12))) / pow(2, 11);
-    X2 = (calib.AC2 * B6) / pow(2, 11);
-    X3 = X1 + X2;
+void BMP180_calib_cache_store(void) {
+    uint32_t words[CALIB_CACHE_WORDS] = {0};
 
-    B3 = ((((int32_t)calib.AC1 * 4 + X3) << BMP180_OSS) + 2) / 4;
-    
-    X1 = (calib.AC3 * B6) / pow(2, 13);
-    X2 = (calib.B1 * (B6 * B6 / pow(2, 12))) / pow(2, 16);
-    X3 = ((X1 + X2) + 2) / pow(2, 2);
+    memcpy(words, &calib, sizeof(calib));
+    words[6] = CALIB_CACHE_TAG;
+    words[7] = Crc32(0xFFFFFFFF, (uint8_t *)words, 7 * 4);
+    HibernateDataSet(words, CALIB_CACHE_WORDS);
+}
 
-    B4 = (uint32_t)calib.AC4 * (uint32_t)(X3 + pow(2, 15)) / pow(2, 15);
+// Gets the calibration coefficients, from the cache when it is valid so that
+// resets and hibernate wakes skip the 22-byte EEPROM read.
+void BMP180_load_calib(void) {
+    SysCtlPeripheralEnable(SYSCTL_PERIPH_HIBERNATE);
+    while(!SysCtlPeripheralReady(SYSCTL_PERIPH_HIBERNATE));
 
-    B7 = ((uint32_t)UP - B3) * (50000 >> BMP180_OSS);
+    // The module keeps running across resets; only start it on first power-up
+    if (!HibernateIsActive())
+        HibernateEnableExpClk(SysCtlClockGet());
 
-    if (B7 < 0x80000000) {
-        P = (B7 * 2) / B4;
-    } else {
-        P = (B7 / B4) * 2;
-    }
+    if (BMP180_calib_cache_load()) return;
 
-    X1 = (P / pow(2, 8)) * (P / pow(2, 8));
-    X1 = (X1 * 3038) / pow(2, 16);
-    X2 = (-7357 * P) / pow(2, 16);
-
-    *pressure = (float)(P + (X1 + X2 + 3791) / pow(2, 4)); // Pressure in Pa
+    BMP180_read_calib_data();
+    if (i2c_bus_err == I2C_MASTER_ERR_NONE)
+        BMP180_calib_cache_store();
 }
 
 
@@ -356,9 +241,9 @@ void BMP180_compensate(int32_t UT, int32_t UP, float *temperature, float *pressu
 // ===============================================
 
 int main(void) {
-    char buffer[17];
-    int32_t uncomp_T, uncomp_P;
+    int32_t uncomp_T = 0, uncomp_P;
     float temperature, pressure;
+    uint32_t sample = 0, period, next, now;
 
     // Set up system clock (40 MHz)
     SysCtlClockSet(SYSCTL_SYSDIV_5 | SYSCTL_USE_PLL |
@@ -368,11 +253,16 @@ int main(void) {
     LCD_init();
     delay_ms(100);
 
-    // Initialize I2C
+    // Initialize I2C; transfers complete from the I2C interrupt
     I2C_init();
+    IntMasterEnable();
     
-    // Read Calibration Data from BMP180 EEPROM
-    BMP180_read_calib_data();
+    // Read Calibration Data (cached copy, or BMP180 EEPROM)
+    BMP180_load_calib();
+
+    // Choose OSS / smoothing for the requested rate and noise
+    bmp180_bus_hz = I2C_speed_hz(BMP180_I2C_SPEED);
+    BMP180_configure(BMP180_RATE_HZ, BMP180_NOISE_DPA);
 
     // Initial Display Message
     LCD_command(0x01); // Clear
@@ -384,31 +274,59 @@ int main(void) {
     delay_ms(2000);
     LCD_command(0x01); // Clear
 
+    HWREG(DEMCR) |= DEMCR_TRCENA;
+    HWREG(DWT_CTRL) |= 1;
+    period = (SysCtlClockGet() / 1000000) * bmp180_period_us;
+    next = HWREG(DWT_CYCCNT);
+
     while(1)
     {
-        // 1. Read Uncompensated Temperature
-        uncomp_T = BMP180_read_UT();
+        // Start each sample one period after the last, whether that loop
+        // read the temperature or updated the display. After an overrun the
+        // schedule restarts from now rather than running samples back to back.
+        while ((int32_t)(HWREG(DWT_CYCCNT) - next) < 0);
+        now = HWREG(DWT_CYCCNT);
+        if (now - next >= period)
+            next = now;
+        next += period;
+
+        // 1. Read Uncompensated Temperature (refreshed about once per second)
+        if (sample % bmp180_temp_every == 0)
+            uncomp_T = BMP180_read_UT();
         
         // 2. Read Uncompensated Pressure
         uncomp_P = BMP180_read_UP();
 
-        // 3. Compensate and Calculate P and T
+        // A failed transfer leaves garbage: free the bus and retry next loop
+        if (i2c_bus_err != I2C_MASTER_ERR_NONE) {
+            I2C_bus_recover();
+            LCD_setCursor(0,0);
+            LCD_print("Sensor error    ");
+            delay_ms(100);
+            continue;
+        }
+
+        // 3. Compensate and Calculate P and T, then smooth P
         BMP180_compensate(uncomp_T, uncomp_P, &temperature, &pressure);
+        pressure = BMP180_filter_pressure(pressure);
+
+        // Show a reading once per second
+        sample++;
+        if (sample % bmp180_temp_every != 0)
+            continue;
 
         // 4. Display Temperature (Row 0)
         LCD_setCursor(0,0);
-        // Format: T: XX.XC (e.g., T: 25.4C)
-        // pressure is in Pa, convert to hPa (mbar) by dividing by 100
-        snprintf(buffer, 17, "T: %.1f C        ", temperature);
-        LCD_print(buffer);
+        // Format: T: XX.X C (e.g., T:   25.4 C), from 0.1 C units
+        FMT_PRINT(&lcd_sink, FMT_S("T: "), FMT_FIX(lroundf(temperature * 10.0f), 1, 1, 6),
+                  FMT_S(" C     "));
 
         // 5. Display Pressure (Row 1)
         LCD_setCursor(1,0);
         // Format: P: XXXX.X hPa (e.g., P: 1013.2 hPa)
-        snprintf(buffer, 17, "P: %.1f hPa  ", pressure / 100.0f); 
-        LCD_print(buffer);
-
-        delay_ms(1000); // Update display every 1 second
+        // pressure is in Pa = 0.01 hPa, shown to 0.1 hPa
+        FMT_PRINT(&lcd_sink, FMT_S("P: "), FMT_FIX(lroundf(pressure), 2, 1, 6),
+                  FMT_S(" hPa   "));
     }
     
     // Should never reach here
@@ -0,0 +1,383 @@
+/******************************************************************************
+ * Project  : 16 character LCD display for BMP180 readings
+ * File     : i2c_bus.c
+ *
+ * Description:
+ * Shared I2C bus manager. Transactions from any number of devices are queued
+ * with I2C_bus_submit() and executed by the I2C0 interrupt, one byte per
+ * interrupt, so the CPU is free while the bus is busy. As soon as one
+ * transaction finishes the next one is started from the interrupt, keeping
+ * the bus saturated. The next transaction is the one with the most urgent
+ * priority; every time a waiting transaction is passed over it ages, so a
+ * low priority device is eventually promoted and never starves.
+ *
+ * Author   : Jithin B.P.
+ * Affiliation: CSpark Research
+ * Email    : jithinuser@gmail.com
+ *
+ * License  : This source code is released under an open-source license.
+ * You may use, modify, and distribute it freely, provided that
+ * proper attribution is given to the original author.
+ *
+ * Created  : 2025
+ ******************************************************************************/
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "inc/hw_memmap.h"
+#include "inc/hw_types.h"
+#include "inc/hw_i2c.h"
+#include "inc/hw_ints.h"
+#include "driverlib/sysctl.h"
+#include "driverlib/gpio.h"
+#include "driverlib/i2c.h"
+#include "driverlib/interrupt.h"
+#include "driverlib/pin_map.h"
+#include "i2c_bus.h"
+
+// Transaction phases (what the next interrupt completes)
+#define PH_REG      0   // Register address sent
+#define PH_TX       1   // Data byte sent, more to go
+#define PH_RX       2   // Data byte received
+#define PH_LAST     3   // Final byte sent with STOP
+
+static const uint32_t i2c_speed_table[] = {100000, 400000, 1000000};
+
+static i2c_xfer_t *volatile i2c_queue;  // Waiting transactions, FIFO order
+static i2c_xfer_t *volatile i2c_cur;    // Transaction on the bus
+static int8_t i2c_cur_speed = -1;       // Speed the module is programmed for
+
+volatile uint32_t i2c_bus_err = I2C_MASTER_ERR_NONE;
+
+uint32_t I2C_speed_hz(i2c_speed_t speed) {
+    return i2c_speed_table[speed];
+}
+
+// Programs the SCL rate and the clock-low timeout for a speed profile
+static void I2C_bus_set_speed(i2c_speed_t speed) {
+    uint32_t clk = SysCtlClockGet();
+    uint32_t hz = i2c_speed_table[speed];
+    uint32_t tout;
+
+    // 100/400 kbps come straight from driverlib
+    I2CMasterInitExpClk(I2C_BUS_BASE, clk, speed != I2C_SPEED_STANDARD);
+
+    // 1 Mbps: same formula, SCL = clk / (2 * (6 + 4) * (TPR + 1))
+    if (speed == I2C_SPEED_FAST_PLUS) {
+        HWREG(I2C_BUS_BASE + I2C_O_MTPR) = ((clk + (20 * hz) - 1) / (20 * hz)) - 1;
+    }
+
+    // Clock-low timeout: upper 8 bits of a 12-bit count of SCL periods
+    tout = (I2C_TIMEOUT_MS * (hz / 1000)) / 16;
+    if (tout > 0xFF) tout = 0xFF;
+    if (tout == 0) tout = 1;
+    I2CMasterTimeoutSet(I2C_BUS_BASE, tout);
+
+    i2c_cur_speed = speed;
+}
+
+// Removes and returns the most urgent waiting transaction. Its effective
+// priority is the device priority minus one level per I2C_AGE_STEP skips;
+// ties go to the transaction already at the current bus speed, then FIFO.
+static i2c_xfer_t *I2C_bus_pick(void) {
+    i2c_xfer_t *x, *best = 0, *prev = 0, *best_prev = 0;
+    int16_t p, best_p = 0;
+
+    for (x = i2c_queue; x; prev = x, x = x->next) {
+        p = (int16_t)x->dev->priority - x->age / I2C_AGE_STEP;
+        if (!best || p < best_p ||
+            (p == best_p && x->dev->speed == i2c_cur_speed &&
+             best->dev->speed != i2c_cur_speed)) {
+            best = x;
+            best_p = p;
+            best_prev = prev;
+        }
+    }
+    if (!best) return 0;
+
+    if (best_prev) best_prev->next = best->next;
+    else i2c_queue = best->next;
+
+    for (x = i2c_queue; x; x = x->next)
+        if (x->age < 0xFF) x->age++;
+
+    best->next = 0;
+    return best;
+}
+
+// Puts the next transaction on the bus. Called with the I2C interrupt masked
+// or from the handler itself.
+static void I2C_bus_start_next(void) {
+    i2c_xfer_t *x;
+
+    if (i2c_cur) return;
+    x = I2C_bus_pick();
+    if (!x) return;
+    i2c_cur = x;
+
+    if (x->dev->speed != i2c_cur_speed)
+        I2C_bus_set_speed(x->dev->speed);
+
+    I2CMasterSlaveAddrSet(I2C_BUS_BASE, x->dev->addr, false);
+    I2CMasterDataPut(I2C_BUS_BASE, x->reg);
+    x->idx = 0;
+    if (x->tx_len == 0 && x->rx_len == 0) {
+        x->phase = PH_LAST;
+        I2CMasterControl(I2C_BUS_BASE, I2C_MASTER_CMD_SINGLE_SEND);
+    } else {
+        x->phase = PH_REG;
+        I2CMasterControl(I2C_BUS_BASE, I2C_MASTER_CMD_BURST_SEND_START);
+    }
+}
+
+// Ends a transaction with err and runs its callback; if it was the one on
+// the bus, the bus is free afterwards
+static void I2C_bus_complete(i2c_xfer_t *x, uint32_t err) {
+    if (x == i2c_cur) i2c_cur = 0;
+    i2c_bus_err |= err;
+    x->err = err;
+    x->busy = false;
+    if (x->done) x->done(x);
+}
+
+static void I2C_bus_finish(uint32_t err) {
+    I2C_bus_complete(i2c_cur, err);
+    I2C_bus_start_next();
+}
+
+void I2C0Handler(void) {
+    i2c_xfer_t *x = i2c_cur;
+    uint32_t status, err;
+
+    status = I2CMasterIntStatusEx(I2C_BUS_BASE, true);
+    I2CMasterIntClearEx(I2C_BUS_BASE, status);
+    if (!x || !status) return;
+
+    err = I2CMasterErr(I2C_BUS_BASE);
+    if (status & I2C_MASTER_INT_TIMEOUT) err |= I2C_MASTER_ERR_CLK_TOUT;
+    if (err != I2C_MASTER_ERR_NONE) {
+        // A burst still holds the bus unless arbitration was lost
+        if (x->phase != PH_LAST && !(err & I2C_MASTER_ERR_ARB_LOST))
+            I2CMasterControl(I2C_BUS_BASE, x->phase == PH_RX ?
+                             I2C_MASTER_CMD_BURST_RECEIVE_ERROR_STOP :
+                             I2C_MASTER_CMD_BURST_SEND_ERROR_STOP);
+        I2C_bus_finish(err);
+        return;
+    }
+
+    switch (x->phase) {
+    case PH_REG:
+        if (x->tx_len) {
+            I2CMasterDataPut(I2C_BUS_BASE, x->tx[x->idx++]);
+            x->phase = (x->idx == x->tx_len) ? PH_LAST : PH_TX;
+            I2CMasterControl(I2C_BUS_BASE, x->phase == PH_LAST ?
+                             I2C_MASTER_CMD_BURST_SEND_FINISH :
+                             I2C_MASTER_CMD_BURST_SEND_CONT);
+        } else {
+            // Repeated start in receive mode
+            I2CMasterSlaveAddrSet(I2C_BUS_BASE, x->dev->addr, true);
+            x->phase = PH_RX;
+            I2CMasterControl(I2C_BUS_BASE, x->rx_len == 1 ?
+                             I2C_MASTER_CMD_SINGLE_RECEIVE :
+                             I2C_MASTER_CMD_BURST_RECEIVE_START);
+        }
+        break;
+
+    case PH_TX:
+        I2CMasterDataPut(I2C_BUS_BASE, x->tx[x->idx++]);
+        if (x->idx == x->tx_len) x->phase = PH_LAST;
+        I2CMasterControl(I2C_BUS_BASE, x->phase == PH_LAST ?
+                         I2C_MASTER_CMD_BURST_SEND_FINISH :
+                         I2C_MASTER_CMD_BURST_SEND_CONT);
+        break;
+
+    case PH_RX:
+        x->rx[x->idx++] = I2CMasterDataGet(I2C_BUS_BASE);
+        if (x->idx == x->rx_len) {
+            I2C_bus_finish(I2C_MASTER_ERR_NONE);
+        } else {
+            I2CMasterControl(I2C_BUS_BASE, (x->rx_len - x->idx) == 1 ?
+                             I2C_MASTER_CMD_BURST_RECEIVE_FINISH :
+                             I2C_MASTER_CMD_BURST_RECEIVE_CONT);
+        }
+        break;
+
+    default: // PH_LAST
+        I2C_bus_finish(I2C_MASTER_ERR_NONE);
+        break;
+    }
+}
+
+// Queues a transaction; returns false if it is already in flight
+bool I2C_bus_submit(i2c_xfer_t *xfer) {
+    i2c_xfer_t **pp;
+    bool masked;
+
+    if (xfer->busy) return false;
+    xfer->busy = true;
+    xfer->err = I2C_MASTER_ERR_NONE;
+    xfer->age = 0;
+    xfer->next = 0;
+
+    masked = IntMasterDisable();
+    for (pp = (i2c_xfer_t **)&i2c_queue; *pp; pp = &(*pp)->next);
+    *pp = xfer;
+    I2C_bus_start_next();
+    if (!masked) IntMasterEnable();
+    return true;
+}
+
+// Drops a transaction, whether waiting or on the bus. It ends with
+// I2C_MASTER_ERR_CLK_TOUT and its callback runs. If the master does not
+// come back from the STOP, the bus is recovered instead.
+void I2C_bus_cancel(i2c_xfer_t *xfer) {
+    i2c_xfer_t **pp;
+    uint32_t spin = I2C_SPIN_LIMIT;
+    bool masked;
+
+    masked = IntMasterDisable();
+    if (i2c_cur == xfer) {
+        // As the handler does on an error: a burst still holds the bus
+        if (xfer->phase != PH_LAST)
+            I2CMasterControl(I2C_BUS_BASE, xfer->phase == PH_RX ?
+                             I2C_MASTER_CMD_BURST_RECEIVE_ERROR_STOP :
+                             I2C_MASTER_CMD_BURST_SEND_ERROR_STOP);
+
+        // The next START waits for the STOP, and the STOP's interrupt
+        // must not be taken as the next transaction's
+        while (I2CMasterBusy(I2C_BUS_BASE) && --spin);
+        if (spin == 0) {
+            if (!masked) IntMasterEnable();
+            I2C_bus_recover();
+            return;
+        }
+        I2CMasterIntClearEx(I2C_BUS_BASE, 0xFFFFFFFF);
+        IntPendClear(I2C_BUS_INT);
+        I2C_bus_complete(xfer, I2C_MASTER_ERR_CLK_TOUT);
+    } else {
+        for (pp = (i2c_xfer_t **)&i2c_queue; *pp; pp = &(*pp)->next) {
+            if (*pp == xfer) {
+                *pp = xfer->next;
+                I2C_bus_complete(xfer, I2C_MASTER_ERR_CLK_TOUT);
+                break;
+            }
+        }
+    }
+    I2C_bus_start_next();
+    if (!masked) IntMasterEnable();
+}
+
+// Blocks until a submitted transaction completes. Bounded, so a dead bus
+// (no interrupt at all) cancels the transaction instead of hanging.
+uint32_t I2C_bus_wait(i2c_xfer_t *xfer) {
+    uint32_t spin = I2C_SPIN_LIMIT * (2u + xfer->tx_len + xfer->rx_len);
+
+    while (xfer->busy) {
+        if (--spin == 0) {
+            I2C_bus_cancel(xfer);
+            break;
+        }
+    }
+    return xfer->err;
+}
+
+// Blocking register access for drivers that do not need to overlap work
+uint32_t I2C_transfer(const i2c_device_t *dev, uint8_t reg,
+                      const uint8_t *tx, uint8_t tx_len,
+                      uint8_t *rx, uint8_t rx_len) {
+    i2c_xfer_t xfer = {0};
+
+    xfer.dev = dev;
+    xfer.reg = reg;
+    xfer.tx = tx;
+    xfer.tx_len = tx_len;
+    xfer.rx = rx;
+    xfer.rx_len = rx_len;
+    I2C_bus_submit(&xfer);
+    return I2C_bus_wait(&xfer);
+}
+
+// Rounded up to whole 3-cycle SysCtlDelay() loops, so never short
+static void I2C_bus_delay_us(uint32_t us) {
+    uint32_t loops = ((SysCtlClockGet() / 1000000) * us + 2) / 3;
+
+    if (loops) SysCtlDelay(loops);
+}
+
+// Releases a bus held by a slave that was reset mid-transfer: SCL is clocked
+// by hand (up to 9 pulses) until the slave lets go of SDA, then a STOP is
+// generated and the pins are handed back to the I2C module. A transaction
+// caught on the bus ends with I2C_MASTER_ERR_CLK_TOUT and its callback runs,
+// here rather than from the interrupt; waiting transactions stay queued and
+// restart afterwards.
+void I2C_bus_recover(void) {
+    uint32_t half = 500000 / I2C_RECOVERY_SCL_HZ; // half period in us
+    uint8_t i;
+    bool masked;
+
+    IntDisable(I2C_BUS_INT);
+    if (i2c_cur)
+        I2C_bus_complete(i2c_cur, I2C_MASTER_ERR_CLK_TOUT);
+
+    GPIOPinTypeGPIOOutputOD(I2C_BUS_GPIO_BASE, I2C_SCL_PIN | I2C_SDA_PIN);
+    GPIOPinWrite(I2C_BUS_GPIO_BASE, I2C_SCL_PIN | I2C_SDA_PIN, I2C_SCL_PIN | I2C_SDA_PIN);
+    I2C_bus_delay_us(half);
+
+    for (i = 0; i < 9 && GPIOPinRead(I2C_BUS_GPIO_BASE, I2C_SDA_PIN) == 0; i++) {
+        GPIOPinWrite(I2C_BUS_GPIO_BASE, I2C_SCL_PIN, 0);
+        I2C_bus_delay_us(half);
+        GPIOPinWrite(I2C_BUS_GPIO_BASE, I2C_SCL_PIN, I2C_SCL_PIN);
+        I2C_bus_delay_us(half);
+    }
+
+    // STOP condition: SDA low -> high while SCL is high
+    GPIOPinWrite(I2C_BUS_GPIO_BASE, I2C_SCL_PIN, 0);
+    I2C_bus_delay_us(half);
+    GPIOPinWrite(I2C_BUS_GPIO_BASE, I2C_SDA_PIN, 0);
+    I2C_bus_delay_us(half);
+    GPIOPinWrite(I2C_BUS_GPIO_BASE, I2C_SCL_PIN, I2C_SCL_PIN);
+    I2C_bus_delay_us(half);
+    GPIOPinWrite(I2C_BUS_GPIO_BASE, I2C_SDA_PIN, I2C_SDA_PIN);
+    I2C_bus_delay_us(half);
+
+    // Back to the I2C peripheral
+    GPIOPinTypeI2CSCL(I2C_BUS_GPIO_BASE, I2C_SCL_PIN);
+    GPIOPinTypeI2C(I2C_BUS_GPIO_BASE, I2C_SDA_PIN);
+    I2C_bus_set_speed(i2c_cur_speed < 0 ? I2C_SPEED_STANDARD : (i2c_speed_t)i2c_cur_speed);
+    I2CMasterIntClearEx(I2C_BUS_BASE, 0xFFFFFFFF);
+    i2c_bus_err = I2C_MASTER_ERR_NONE;
+
+    IntEnable(I2C_BUS_INT);
+    masked = IntMasterDisable();
+    I2C_bus_start_next();
+    if (!masked) IntMasterEnable();
+}
+
+// Leaves the processor's interrupts as they are; enable them (IntMasterEnable())
+// before the first transfer.
+void I2C_bus_init(void) {
+    // Enable I2C0 and GPIOB peripherals
+    SysCtlPeripheralEnable(SYSCTL_PERIPH_I2C0);
+    SysCtlPeripheralEnable(SYSCTL_PERIPH_GPIOB);
+
+    // Wait for the peripherals to be ready
+    while(!SysCtlPeripheralReady(SYSCTL_PERIPH_I2C0));
+    while(!SysCtlPeripheralReady(SYSCTL_PERIPH_GPIOB));
+
+    // PB2 (SCL), PB3 (SDA)
+    GPIOPinConfigure(GPIO_PB2_I2C0SCL);
+    GPIOPinConfigure(GPIO_PB3_I2C0SDA);
+    GPIOPinTypeI2CSCL(I2C_BUS_GPIO_BASE, I2C_SCL_PIN);
+    GPIOPinTypeI2C(I2C_BUS_GPIO_BASE, I2C_SDA_PIN);
+
+    I2C_bus_set_speed(I2C_SPEED_STANDARD);
+
+    // One interrupt per completed byte, plus clock-low timeout
+    I2CMasterIntEnableEx(I2C_BUS_BASE, I2C_MASTER_INT_DATA | I2C_MASTER_INT_TIMEOUT);
+    IntEnable(I2C_BUS_INT);
+
+    // Free the bus in case a slave was left mid-transfer by a reset
+    if (I2CMasterBusBusy(I2C_BUS_BASE) ||
+        (I2CMasterLineStateGet(I2C_BUS_BASE) & I2C_MBMON_SDA) == 0)
+        I2C_bus_recover();
+}
@@ -0,0 +1,97 @@
+/******************************************************************************
+ * Project  : 16 character LCD display for BMP180 readings
+ * File     : i2c_bus.h
+ *
+ * Description:
+ * Shared I2C bus manager. Several device drivers queue transactions on one
+ * I2C master module; the interrupt handler runs them back-to-back, most
+ * urgent device first, switching SCL speed per device as needed.
+ *
+ * I2C Pin Connections for TM4C123G (using I2C0 module):
+ * - SCL -> Tiva C **PB2**
+ * - SDA -> Tiva C **PB3**
+ *
+ * Author   : Jithin B.P.
+ * Affiliation: CSpark Research
+ * Email    : jithinuser@gmail.com
+ *
+ * License  : This source code is released under an open-source license.
+ * You may use, modify, and distribute it freely, provided that
+ * proper attribution is given to the original author.
+ *
+ * Created  : 2025
+ ******************************************************************************/
+
+#ifndef I2C_BUS_H
+#define I2C_BUS_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+// ------------ Bus hardware ------------
+#define I2C_BUS_BASE        I2C0_BASE
+#define I2C_BUS_INT         INT_I2C0
+#define I2C_BUS_GPIO_BASE   GPIO_PORTB_BASE
+#define I2C_SCL_PIN         GPIO_PIN_2
+#define I2C_SDA_PIN         GPIO_PIN_3
+
+#define I2C_TIMEOUT_MS      2           // Clock-low timeout (capped at 4080 SCL periods)
+#define I2C_SPIN_LIMIT      200000      // Software bound on a blocking wait, per byte
+#define I2C_RECOVERY_SCL_HZ 50000       // Bit-banged SCL rate during bus recovery
+#define I2C_AGE_STEP        4           // Skips that promote a waiting transfer one priority level
+
+typedef enum {
+    I2C_SPEED_STANDARD,                 // 100 kbps
+    I2C_SPEED_FAST,                     // 400 kbps
+    I2C_SPEED_FAST_PLUS                 // 1 Mbps (needs ~2.2k pull-ups)
+} i2c_speed_t;
+
+// One slave on the bus
+typedef struct {
+    uint8_t addr;                       // 7-bit address
+    i2c_speed_t speed;                  // Fastest SCL rate the device accepts
+    uint8_t priority;                   // 0 = most urgent
+} i2c_device_t;
+
+typedef struct i2c_xfer i2c_xfer_t;
+
+// Completion callback, called from the I2C interrupt
+typedef void (*i2c_done_fn)(i2c_xfer_t *xfer);
+
+// One register transaction: write reg, then tx bytes, or read rx bytes back
+// with a repeated start. The structure must stay valid until busy clears.
+struct i2c_xfer {
+    const i2c_device_t *dev;
+    uint8_t reg;
+    const uint8_t *tx;
+    uint8_t tx_len;
+    uint8_t *rx;
+    uint8_t rx_len;
+    i2c_done_fn done;                   // May be NULL
+    void *ctx;                          // Free for the caller
+
+    volatile bool busy;                 // Set by I2C_bus_submit, cleared on completion
+    volatile uint32_t err;              // I2C_MASTER_ERR_* once busy is clear
+
+    // Scheduler state
+    uint8_t age;
+    uint8_t phase;
+    uint8_t idx;
+    i2c_xfer_t *next;
+};
+
+// Sticky I2C_MASTER_ERR_* flags since the last bus recovery
+extern volatile uint32_t i2c_bus_err;
+
+void I2C_bus_init(void);
+bool I2C_bus_submit(i2c_xfer_t *xfer);
+void I2C_bus_cancel(i2c_xfer_t *xfer);
+uint32_t I2C_bus_wait(i2c_xfer_t *xfer);
+uint32_t I2C_transfer(const i2c_device_t *dev, uint8_t reg,
+                      const uint8_t *tx, uint8_t tx_len,
+                      uint8_t *rx, uint8_t rx_len);
+void I2C_bus_recover(void);
+uint32_t I2C_speed_hz(i2c_speed_t speed);
+void I2C0Handler(void);
+
+#endif // I2C_BUS_H
@@ -57,6 +57,7 @@ extern uint32_t __STACK_TOP;
 //
 //*****************************************************************************
 extern void ADCSeq0Handler(void);
+extern void I2C0Handler(void);
 
 //*****************************************************************************
 //
@@ -93,7 +94,7 @@ void (* const g_pfnVectors[])(void) =
     IntDefaultHandler,                      // UART0 Rx and Tx
     IntDefaultHandler,                      // UART1 Rx and Tx
     IntDefaultHandler,                      // SSI0 Rx and Tx
-    IntDefaultHandler,                      // I2C0 Master and Slave
+    I2C0Handler,                            // I2C0 Master and Slave
     IntDefaultHandler,                      // PWM Fault
     IntDefaultHandler,                      // PWM Generator 0
     IntDefaultHandler,                      // PWM Generator 1
@@ -0,0 +1,228 @@
+/******************************************************************************
+ * Project  : Software CRC host benchmark
+ * File     : crc_bench.c
+ *
+ * Description:
+ * Runs driverlib/sw_crc.c on a Linux PC. Checks that Crc32Slice4() and
+ * Crc32Slice8() return exactly what Crc32() returns for every length from 0
+ * to 300 bytes at every start alignment, and for blocks split at arbitrary
+ * points across calls (running CRC). Then times the three functions in
+ * MB/s for a range of block sizes and alignments.
+ *
+ * Crc16Lanes() is checked against one Crc16() call per lane for 1 to 8
+ * lanes (odd lengths, mixed alignments, split calls) and timed against
+ * the same sequential calls.
+ *
+ * The on-target numbers (cycles per byte, with flash wait states) are
+ * printed by the hello example at start-up.
+ *
+ * Build and run (from this folder):
+ *   gcc -O2 -Wall -I.. crc_bench.c ../driverlib/sw_crc.c -o crc_bench
+ *   ./crc_bench
+ * Add -DSW_CRC32_SLICE=4 (or 1) to see the smaller-table builds.
+ *
+ * Author   : Jithin B.P.
+ * Affiliation: CSpark Research
+ * Email    : jithinuser@gmail.com
+ *
+ * License  : This source code is released under an open-source license.
+ * You may use, modify, and distribute it freely, provided that
+ * proper attribution is given to the original author.
+ *
+ * Created  : 2025
+ ******************************************************************************/
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <time.h>
+#include "driverlib/sw_crc.h"
+
+#define BENCH_MAX       65536
+#define CHECK_MAX       300
+#define LANES_MAX       8
+#define LANE_BYTES      1024
+
+typedef uint32_t (*crc_fn_t)(uint32_t, const uint8_t *, uint32_t);
+
+static const crc_fn_t crc_fns[3] = {Crc32, Crc32Slice4, Crc32Slice8};
+static const char * const crc_names[3] = {"Crc32", "Crc32Slice4", "Crc32Slice8"};
+
+// Extra bytes so any block can start at any alignment
+static uint8_t buf[BENCH_MAX + 8] __attribute__((aligned(8)));
+
+static double now_s(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+// Every length and alignment, whole block and split in two at every point
+static int check(void)
+{
+    uint32_t len, align, split, ref, crc;
+    int f, errors = 0;
+
+    for (align = 0; align < 8; align++) {
+        for (len = 0; len <= CHECK_MAX; len++) {
+            ref = Crc32(0xFFFFFFFF, buf + align, len);
+            for (f = 1; f < 3; f++) {
+                if (crc_fns[f](0xFFFFFFFF, buf + align, len) != ref) {
+                    printf("%s: mismatch, align %u len %u\n",
+                           crc_names[f], align, len);
+                    errors++;
+                }
+                for (split = 0; split <= len; split += 7) {
+                    crc = crc_fns[f](0xFFFFFFFF, buf + align, split);
+                    crc = crc_fns[f](crc, buf + align + split, len - split);
+                    if (crc != ref) {
+                        printf("%s: split mismatch, align %u len %u at %u\n",
+                               crc_names[f], align, len, split);
+                        errors++;
+                    }
+                }
+            }
+        }
+    }
+
+    // Check value for "123456789" (final XOR applied by the caller)
+    for (f = 0; f < 3; f++) {
+        crc = crc_fns[f](0xFFFFFFFF, (const uint8_t *)"123456789", 9) ^ 0xFFFFFFFF;
+        if (crc != 0xCBF43926) {
+            printf("%s: check value %08X, expected CBF43926\n", crc_names[f], crc);
+            errors++;
+        }
+    }
+
+    return errors;
+}
+
+// Crc16Lanes() against Crc16() per lane, for every lane count
+static int check_lanes(void)
+{
+    const uint8_t *ptrs[LANES_MAX];
+    uint16_t crcs[LANES_MAX], ref;
+    uint32_t lanes, lane, len, split;
+    int errors = 0;
+
+    for (lanes = 1; lanes <= LANES_MAX; lanes++) {
+        for (len = 0; len <= 67; len += 3) {
+            for (split = 0; split <= len; split += 5) {
+                for (lane = 0; lane < lanes; lane++) {
+                    // Each lane starts somewhere else, at any alignment
+                    ptrs[lane] = buf + lane * 301 + lane % 4;
+                    crcs[lane] = (uint16_t)(lane * 0x1111);
+                }
+                Crc16Lanes(lanes, crcs, ptrs, split);
+                for (lane = 0; lane < lanes; lane++)
+                    ptrs[lane] += split;
+                Crc16Lanes(lanes, crcs, ptrs, len - split);
+
+                for (lane = 0; lane < lanes; lane++) {
+                    ref = Crc16((uint16_t)(lane * 0x1111),
+                                buf + lane * 301 + lane % 4, len);
+                    if (crcs[lane] != ref) {
+                        printf("Crc16Lanes: %u lanes, lane %u, len %u split %u: "
+                               "%04X, expected %04X\n", lanes, lane, len, split,
+                               crcs[lane], ref);
+                        errors++;
+                    }
+                }
+            }
+        }
+    }
+
+    return errors;
+}
+
+static double bench(crc_fn_t fn, const uint8_t *p, uint32_t len)
+{
+    volatile uint32_t sink = 0;
+    uint32_t reps, i;
+    double t0, t;
+
+    // Aim for about 64 MB per measurement
+    reps = (64u << 20) / len;
+    if (reps == 0)
+        reps = 1;
+
+    t0 = now_s();
+    for (i = 0; i < reps; i++)
+        sink ^= fn(0xFFFFFFFF, p, len);
+    t = now_s() - t0;
+
+    return (double)len * reps / t / 1e6;
+}
+
+// MB/s over all lanes: one Crc16Lanes() call, or one Crc16() per lane
+static void bench_lanes(uint32_t lanes, double *mbs_lanes, double *mbs_seq)
+{
+    const uint8_t *ptrs[LANES_MAX];
+    uint16_t crcs[LANES_MAX];
+    volatile uint16_t sink = 0;
+    uint32_t reps = (64u << 20) / (LANE_BYTES * lanes);
+    uint32_t i, lane;
+    double t0;
+
+    for (lane = 0; lane < lanes; lane++)
+        ptrs[lane] = buf + lane * LANE_BYTES;
+
+    t0 = now_s();
+    for (i = 0; i < reps; i++) {
+        for (lane = 0; lane < lanes; lane++)
+            crcs[lane] = 0;
+        Crc16Lanes(lanes, crcs, ptrs, LANE_BYTES);
+        sink ^= crcs[0];
+    }
+    *mbs_lanes = (double)LANE_BYTES * lanes * reps / (now_s() - t0) / 1e6;
+
+    t0 = now_s();
+    for (i = 0; i < reps; i++) {
+        for (lane = 0; lane < lanes; lane++)
+            sink ^= Crc16(0, ptrs[lane], LANE_BYTES);
+    }
+    *mbs_seq = (double)LANE_BYTES * lanes * reps / (now_s() - t0) / 1e6;
+}
+
+int main(void)
+{
+    static const uint32_t sizes[] = {16, 64, 256, 1024, 4096, BENCH_MAX};
+    uint32_t i, s, align;
+    double mbs_lanes, mbs_seq;
+    int f, errors, lane_errors;
+
+    srand(1);
+    for (i = 0; i < sizeof(buf); i++)
+        buf[i] = (uint8_t)rand();
+
+    printf("SW_CRC32_SLICE = %d\n", SW_CRC32_SLICE);
+    errors = check();
+    printf("Conformance: %s (%d errors, lengths 0..%d, 8 alignments, split calls)\n",
+           errors ? "FAIL" : "PASS", errors, CHECK_MAX);
+    lane_errors = check_lanes();
+    printf("Crc16Lanes:  %s (%d errors, 1..%d lanes vs Crc16)\n\n",
+           lane_errors ? "FAIL" : "PASS", lane_errors, LANES_MAX);
+    errors += lane_errors;
+
+    printf(" size al   Crc32 MB/s  Slice4 MB/s  Slice8 MB/s\n");
+    for (s = 0; s < sizeof(sizes) / sizeof(sizes[0]); s++) {
+        for (align = 0; align < 4; align++) {
+            printf("%5u %2u", sizes[s], align);
+            for (f = 0; f < 3; f++)
+                printf(" %12.1f", bench(crc_fns[f], buf + align, sizes[s]));
+            printf("\n");
+        }
+    }
+
+
+    printf("\nCRC-16, %u bytes per lane\n", LANE_BYTES);
+    printf("lanes  Crc16Lanes MB/s  Crc16 x lanes MB/s\n");
+    for (f = 1; f <= LANES_MAX; f++) {
+        bench_lanes(f, &mbs_lanes, &mbs_seq);
+        printf("%5d %16.1f %19.1f\n", f, mbs_lanes, mbs_seq);
+    }
+
+    return errors ? 1 : 0;
+}
@@ -0,0 +1,83 @@
+/******************************************************************************
+ * Project  : Software CRC host benchmark
+ * File     : crc_table_check.cpp
+ *
+ * Description:
+ * Checks the compile-time tables of utils/crc_table.hpp against
+ * driverlib/sw_crc.c: all 256 entries of the CRC-8, CRC-16 and CRC-32
+ * tables, and running CRCs over random buffers split at random points.
+ * The catalogue check values are static_asserts in the header, so a
+ * wrong table does not compile in the first place.
+ *
+ * Build and run (from this folder):
+ *   gcc -O2 -c -I.. ../driverlib/sw_crc.c -o sw_crc.o
+ *   g++ -O2 -std=c++14 -Wall -I.. crc_table_check.cpp sw_crc.o -o crc_table_check
+ *   ./crc_table_check
+ *
+ * Author   : Jithin B.P.
+ * Affiliation: CSpark Research
+ * Email    : jithinuser@gmail.com
+ *
+ * License  : This source code is released under an open-source license.
+ * You may use, modify, and distribute it freely, provided that
+ * proper attribution is given to the original author.
+ *
+ * Created  : 2025
+ ******************************************************************************/
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstdint>
+#include "driverlib/sw_crc.h"
+#include "utils/crc_table.hpp"
+
+static int errors;
+
+static void expect(bool ok, const char *what, unsigned i)
+{
+    if (!ok) {
+        printf("%s: mismatch at %u\n", what, i);
+        errors++;
+    }
+}
+
+int main()
+{
+    static uint8_t buf[4096];
+    unsigned i, len, split;
+
+    // A single byte from CRC 0 is exactly one table entry
+    for (i = 0; i < 256; i++) {
+        uint8_t b = (uint8_t)i;
+        expect(crc::Crc8CCITT::table.v[i] == Crc8CCITT(0, &b, 1), "CRC-8 table", i);
+        expect(crc::Crc16::table.v[i] == Crc16(0, &b, 1), "CRC-16 table", i);
+        expect(crc::Crc32::table.v[i] == Crc32(0, &b, 1), "CRC-32 table", i);
+    }
+
+    srand(1);
+    for (i = 0; i < sizeof(buf); i++)
+        buf[i] = (uint8_t)rand();
+
+    for (i = 0; i < 1000; i++) {
+        len = rand() % 1024;
+        split = len ? rand() % len : 0;
+        const uint8_t *p = buf + rand() % 64;
+
+        uint32_t c32 = crc::Crc32::update(0xFFFFFFFF, p, split);
+        c32 = crc::Crc32::update(c32, p + split, len - split);
+        expect(c32 == Crc32(0xFFFFFFFF, p, len), "CRC-32 running", i);
+        expect((c32 ^ 0xFFFFFFFF) == crc::Crc32::compute(p, len), "CRC-32 compute", i);
+
+        uint16_t c16 = crc::Crc16::update(0, p, split);
+        c16 = crc::Crc16::update(c16, p + split, len - split);
+        expect(c16 == Crc16(0, p, len), "CRC-16 running", i);
+
+        uint8_t c8 = crc::Crc8CCITT::update(0, p, split);
+        c8 = crc::Crc8CCITT::update(c8, p + split, len - split);
+        expect(c8 == Crc8CCITT(0, p, len), "CRC-8 running", i);
+    }
+
+    printf("crc_table.hpp vs sw_crc.c: %s (%d errors)\n",
+           errors ? "FAIL" : "PASS", errors);
+    return errors ? 1 : 0;
+}
@@ -0,0 +1,870 @@
+//*****************************************************************************
+//
+// sw_aes.c - Software AES (ECB, CBC, CTR and GCM) for parts without the AES
+//            module.
+//
+// Author      : Jithin B.P.
+// Affiliation : CSpark Research
+// Email       : jithinuser@gmail.com
+//
+// License     : This source code is released under an open-source license.
+// You may use, modify, and distribute it freely, provided that proper
+// attribution is given to the original author.
+//
+// Created     : 2025
+//
+//*****************************************************************************
+
+//*****************************************************************************
+//
+//! \addtogroup sw_aes_api
+//! @{
+//
+//*****************************************************************************
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "driverlib/debug.h"
+#include "driverlib/sw_aes.h"
+
+//*****************************************************************************
+//
+// The combined SubBytes/MixColumns table for encryption.  State columns are
+// held as little-endian words (row 0 in the low byte), so entry x is the
+// column {02}.S[x], S[x], S[x], {03}.S[x] read from the low byte up.  The
+// other three rows use the same entry rotated by 8, 16 and 24 bits, which
+// the Cortex-M4 folds into the EOR for free, so one 1 KB table serves all
+// four where the textbook version has four.
+//
+//*****************************************************************************
+static const uint32_t g_pui32AESTe0[256] =
+{
+    0xa56363c6, 0x847c7cf8, 0x997777ee, 0x8d7b7bf6,
+    0x0df2f2ff, 0xbd6b6bd6, 0xb16f6fde, 0x54c5c591,
+    0x50303060, 0x03010102, 0xa96767ce, 0x7d2b2b56,
+    0x19fefee7, 0x62d7d7b5, 0xe6abab4d, 0x9a7676ec,
+    0x45caca8f, 0x9d82821f, 0x40c9c989, 0x877d7dfa,
+    0x15fafaef, 0xeb5959b2, 0xc947478e, 0x0bf0f0fb,
+    0xecadad41, 0x67d4d4b3, 0xfda2a25f, 0xeaafaf45,
+    0xbf9c9c23, 0xf7a4a453, 0x967272e4, 0x5bc0c09b,
+    0xc2b7b775, 0x1cfdfde1, 0xae93933d, 0x6a26264c,
+    0x5a36366c, 0x413f3f7e, 0x02f7f7f5, 0x4fcccc83,
+    0x5c343468, 0xf4a5a551, 0x34e5e5d1, 0x08f1f1f9,
+    0x937171e2, 0x73d8d8ab, 0x53313162, 0x3f15152a,
+    0x0c040408, 0x52c7c795, 0x65232346, 0x5ec3c39d,
+    0x28181830, 0xa1969637, 0x0f05050a, 0xb59a9a2f,
+    0x0907070e, 0x36121224, 0x9b80801b, 0x3de2e2df,
+    0x26ebebcd, 0x6927274e, 0xcdb2b27f, 0x9f7575ea,
+    0x1b090912, 0x9e83831d, 0x742c2c58, 0x2e1a1a34,
+    0x2d1b1b36, 0xb26e6edc, 0xee5a5ab4, 0xfba0a05b,
+    0xf65252a4, 0x4d3b3b76, 0x61d6d6b7, 0xceb3b37d,
+    0x7b292952, 0x3ee3e3dd, 0x712f2f5e, 0x97848413,
+    0xf55353a6, 0x68d1d1b9, 0x00000000, 0x2cededc1,
+    0x60202040, 0x1ffcfce3, 0xc8b1b179, 0xed5b5bb6,
+    0xbe6a6ad4, 0x46cbcb8d, 0xd9bebe67, 0x4b393972,
+    0xde4a4a94, 0xd44c4c98, 0xe85858b0, 0x4acfcf85,
+    0x6bd0d0bb, 0x2aefefc5, 0xe5aaaa4f, 0x16fbfbed,
+    0xc5434386, 0xd74d4d9a, 0x55333366, 0x94858511,
+    0xcf45458a, 0x10f9f9e9, 0x06020204, 0x817f7ffe,
+    0xf05050a0, 0x443c3c78, 0xba9f9f25, 0xe3a8a84b,
+    0xf35151a2, 0xfea3a35d, 0xc0404080, 0x8a8f8f05,
+    0xad92923f, 0xbc9d9d21, 0x48383870, 0x04f5f5f1,
+    0xdfbcbc63, 0xc1b6b677, 0x75dadaaf, 0x63212142,
+    0x30101020, 0x1affffe5, 0x0ef3f3fd, 0x6dd2d2bf,
+    0x4ccdcd81, 0x140c0c18, 0x35131326, 0x2fececc3,
+    0xe15f5fbe, 0xa2979735, 0xcc444488, 0x3917172e,
+    0x57c4c493, 0xf2a7a755, 0x827e7efc, 0x473d3d7a,
+    0xac6464c8, 0xe75d5dba, 0x2b191932, 0x957373e6,
+    0xa06060c0, 0x98818119, 0xd14f4f9e, 0x7fdcdca3,
+    0x66222244, 0x7e2a2a54, 0xab90903b, 0x8388880b,
+    0xca46468c, 0x29eeeec7, 0xd3b8b86b, 0x3c141428,
+    0x79dedea7, 0xe25e5ebc, 0x1d0b0b16, 0x76dbdbad,
+    0x3be0e0db, 0x56323264, 0x4e3a3a74, 0x1e0a0a14,
+    0xdb494992, 0x0a06060c, 0x6c242448, 0xe45c5cb8,
+    0x5dc2c29f, 0x6ed3d3bd, 0xefacac43, 0xa66262c4,
+    0xa8919139, 0xa4959531, 0x37e4e4d3, 0x8b7979f2,
+    0x32e7e7d5, 0x43c8c88b, 0x5937376e, 0xb76d6dda,
+    0x8c8d8d01, 0x64d5d5b1, 0xd24e4e9c, 0xe0a9a949,
+    0xb46c6cd8, 0xfa5656ac, 0x07f4f4f3, 0x25eaeacf,
+    0xaf6565ca, 0x8e7a7af4, 0xe9aeae47, 0x18080810,
+    0xd5baba6f, 0x887878f0, 0x6f25254a, 0x722e2e5c,
+    0x241c1c38, 0xf1a6a657, 0xc7b4b473, 0x51c6c697,
+    0x23e8e8cb, 0x7cdddda1, 0x9c7474e8, 0x211f1f3e,
+    0xdd4b4b96, 0xdcbdbd61, 0x868b8b0d, 0x858a8a0f,
+    0x907070e0, 0x423e3e7c, 0xc4b5b571, 0xaa6666cc,
+    0xd8484890, 0x05030306, 0x01f6f6f7, 0x120e0e1c,
+    0xa36161c2, 0x5f35356a, 0xf95757ae, 0xd0b9b969,
+    0x91868617, 0x58c1c199, 0x271d1d3a, 0xb99e9e27,
+    0x38e1e1d9, 0x13f8f8eb, 0xb398982b, 0x33111122,
+    0xbb6969d2, 0x70d9d9a9, 0x898e8e07, 0xa7949433,
+    0xb69b9b2d, 0x221e1e3c, 0x92878715, 0x20e9e9c9,
+    0x49cece87, 0xff5555aa, 0x78282850, 0x7adfdfa5,
+    0x8f8c8c03, 0xf8a1a159, 0x80898909, 0x170d0d1a,
+    0xdabfbf65, 0x31e6e6d7, 0xc6424284, 0xb86868d0,
+    0xc3414182, 0xb0999929, 0x772d2d5a, 0x110f0f1e,
+    0xcbb0b07b, 0xfc5454a8, 0xd6bbbb6d, 0x3a16162c
+};
+
+//*****************************************************************************
+//
+// The S-box, taken from the middle of the table entry.
+//
+//*****************************************************************************
+#define SBOX(x)                 ((g_pui32AESTe0[(x)] >> 8) & 0xff)
+
+#define ROTL8(x)                (((x) << 8) | ((x) >> 24))
+#define ROTL16(x)               (((x) << 16) | ((x) >> 16))
+#define ROTL24(x)               (((x) << 24) | ((x) >> 8))
+
+//*****************************************************************************
+//
+// Little- and big-endian loads and stores that make no alignment assumption.
+//
+//*****************************************************************************
+#define LOAD_LE32(p)                                                          \
+        ((uint32_t)(p)[0] | ((uint32_t)(p)[1] << 8) |                         \
+         ((uint32_t)(p)[2] << 16) | ((uint32_t)(p)[3] << 24))
+#define STORE_LE32(p, v)                                                      \
+        do                                                                    \
+        {                                                                     \
+            (p)[0] = (uint8_t)(v);                                            \
+            (p)[1] = (uint8_t)((v) >> 8);                                     \
+            (p)[2] = (uint8_t)((v) >> 16);                                    \
+            (p)[3] = (uint8_t)((v) >> 24);                                    \
+        }                                                                     \
+        while(0)
+#define LOAD_BE32(p)                                                          \
+        (((uint32_t)(p)[0] << 24) | ((uint32_t)(p)[1] << 16) |                \
+         ((uint32_t)(p)[2] << 8) | (uint32_t)(p)[3])
+#define STORE_BE32(p, v)                                                      \
+        do                                                                    \
+        {                                                                     \
+            (p)[0] = (uint8_t)((v) >> 24);                                    \
+            (p)[1] = (uint8_t)((v) >> 16);                                    \
+            (p)[2] = (uint8_t)((v) >> 8);                                     \
+            (p)[3] = (uint8_t)(v);                                            \
+        }                                                                     \
+        while(0)
+
+//*****************************************************************************
+//
+// One full round: column c of the output takes row r from column c + r of
+// the input (ShiftRows), through the table (SubBytes and MixColumns), then
+// the round key.
+//
+//*****************************************************************************
+#define AES_ROUND(o0, o1, o2, o3, i0, i1, i2, i3, rk)                         \
+        do                                                                    \
+        {                                                                     \
+            o0 = (rk)[0] ^ g_pui32AESTe0[i0 & 0xff] ^                         \
+                 ROTL8(g_pui32AESTe0[(i1 >> 8) & 0xff]) ^                     \
+                 ROTL16(g_pui32AESTe0[(i2 >> 16) & 0xff]) ^                   \
+                 ROTL24(g_pui32AESTe0[i3 >> 24]);                             \
+            o1 = (rk)[1] ^ g_pui32AESTe0[i1 & 0xff] ^                         \
+                 ROTL8(g_pui32AESTe0[(i2 >> 8) & 0xff]) ^                     \
+                 ROTL16(g_pui32AESTe0[(i3 >> 16) & 0xff]) ^                   \
+                 ROTL24(g_pui32AESTe0[i0 >> 24]);                             \
+            o2 = (rk)[2] ^ g_pui32AESTe0[i2 & 0xff] ^                         \
+                 ROTL8(g_pui32AESTe0[(i3 >> 8) & 0xff]) ^                     \
+                 ROTL16(g_pui32AESTe0[(i0 >> 16) & 0xff]) ^                   \
+                 ROTL24(g_pui32AESTe0[i1 >> 24]);                             \
+            o3 = (rk)[3] ^ g_pui32AESTe0[i3 & 0xff] ^                         \
+                 ROTL8(g_pui32AESTe0[(i0 >> 8) & 0xff]) ^                     \
+                 ROTL16(g_pui32AESTe0[(i1 >> 16) & 0xff]) ^                   \
+                 ROTL24(g_pui32AESTe0[i2 >> 24]);                             \
+        }                                                                     \
+        while(0)
+
+//*****************************************************************************
+//
+// The last round has no MixColumns.
+//
+//*****************************************************************************
+#define AES_FINAL(i0, i1, i2, i3, rk)                                         \
+        ((rk) ^ SBOX(i0 & 0xff) ^ (SBOX((i1 >> 8) & 0xff) << 8) ^            \
+         (SBOX((i2 >> 16) & 0xff) << 16) ^ (SBOX(i3 >> 24) << 24))
+
+//*****************************************************************************
+//
+// The GHASH reduction of the four bits shifted out of the low end, as the
+// top 16 bits of the high word (see the GCM specification, section 4.1).
+//
+//*****************************************************************************
+static const uint16_t g_pui16GHASHLast4[16] =
+{
+    0x0000, 0x1c20, 0x3840, 0x2460, 0x7080, 0x6ca0, 0x48c0, 0x54e0,
+    0xe100, 0xfd20, 0xd940, 0xc560, 0x9180, 0x8da0, 0xa9c0, 0xb5e0
+};
+
+//*****************************************************************************
+//
+//! Configures a software AES context.
+//!
+//! \param psCtx is the context to configure.
+//! \param ui32Config is the configuration of the AES operation, the logical
+//! OR of a direction, a key size, a mode and, for CTR, a counter width, as
+//! for AESConfigSet().
+//!
+//! The direction is one of \b AES_CFG_DIR_ENCRYPT or
+//! \b AES_CFG_DIR_DECRYPT; the key size one of \b AES_CFG_KEY_SIZE_128BIT,
+//! \b AES_CFG_KEY_SIZE_192BIT or \b AES_CFG_KEY_SIZE_256BIT.  The supported
+//! modes are:
+//!
+//! - \b AES_CFG_MODE_ECB and \b AES_CFG_MODE_CBC, encryption only
+//! - \b AES_CFG_MODE_CTR, with \b AES_CFG_CTR_WIDTH_32, \b _64, \b _96 or
+//!   \b _128; both directions are the same operation
+//! - \b AES_CFG_MODE_GCM_HY0CALC, with a 96-bit IV
+//!
+//! The key size given here is ignored; SWAESKey1Set() sets it with the key.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void
+SWAESConfigSet(tSWAESContext *psCtx, uint32_t ui32Config)
+{
+    //
+    // Check the arguments.
+    //
+    ASSERT(((ui32Config & AES_CFG_MODE_M) == AES_CFG_MODE_CTR) ||
+           ((ui32Config & AES_CFG_MODE_M) == AES_CFG_MODE_GCM_HY0CALC) ||
+           ((((ui32Config & AES_CFG_MODE_M) == AES_CFG_MODE_ECB) ||
+             ((ui32Config & AES_CFG_MODE_M) == AES_CFG_MODE_CBC)) &&
+            (ui32Config & AES_CFG_DIR_ENCRYPT)));
+
+    psCtx->ui32Config = ui32Config;
+}
+
+//*****************************************************************************
+//
+// Builds the 4-bit GHASH tables for H = E(K, 0^128): entry i holds i.H in
+// the GCM bit order, high 64 bits in HH and low 64 bits in HL.
+//
+//*****************************************************************************
+static void
+_SWAESGHASHInit(tSWAESContext *psCtx)
+{
+    uint8_t pui8H[16];
+    uint64_t ui64Hi, ui64Lo;
+    uint32_t ui32Idx, ui32Step;
+
+    for(ui32Idx = 0; ui32Idx < 16; ui32Idx++)
+    {
+        pui8H[ui32Idx] = 0;
+    }
+    SWAESBlockEncrypt(psCtx, pui8H, pui8H);
+
+    ui64Hi = ((uint64_t)LOAD_BE32(pui8H) << 32) | LOAD_BE32(pui8H + 4);
+    ui64Lo = ((uint64_t)LOAD_BE32(pui8H + 8) << 32) | LOAD_BE32(pui8H + 12);
+
+    //
+    // H itself goes at index 8 (the bits are reflected), and each halving
+    // of the index is a multiplication by x.
+    //
+    psCtx->pui64HH[0] = 0;
+    psCtx->pui64HL[0] = 0;
+    psCtx->pui64HH[8] = ui64Hi;
+    psCtx->pui64HL[8] = ui64Lo;
+    for(ui32Idx = 4; ui32Idx > 0; ui32Idx >>= 1)
+    {
+        uint32_t ui32T = (uint32_t)(ui64Lo & 1) * 0xe1000000;
+
+        ui64Lo = (ui64Hi << 63) | (ui64Lo >> 1);
+        ui64Hi = (ui64Hi >> 1) ^ ((uint64_t)ui32T << 32);
+        psCtx->pui64HH[ui32Idx] = ui64Hi;
+        psCtx->pui64HL[ui32Idx] = ui64Lo;
+    }
+
+    //
+    // The rest are sums of those.
+    //
+    for(ui32Idx = 2; ui32Idx <= 8; ui32Idx <<= 1)
+    {
+        for(ui32Step = 1; ui32Step < ui32Idx; ui32Step++)
+        {
+            psCtx->pui64HH[ui32Idx + ui32Step] =
+                psCtx->pui64HH[ui32Idx] ^ psCtx->pui64HH[ui32Step];
+            psCtx->pui64HL[ui32Idx + ui32Step] =
+                psCtx->pui64HL[ui32Idx] ^ psCtx->pui64HL[ui32Step];
+        }
+    }
+}
+
+//*****************************************************************************
+//
+//! Sets the key of a software AES context.
+//!
+//! \param psCtx is the context.
+//! \param pui32Key is the key, 4, 6 or 8 words in the byte order of the
+//! key as written (the same layout AESKey1Set() takes).
+//! \param ui32Keysize is \b AES_CFG_KEY_SIZE_128BIT,
+//! \b AES_CFG_KEY_SIZE_192BIT or \b AES_CFG_KEY_SIZE_256BIT.
+//!
+//! The key is expanded here, once, so this is the expensive call (about as
+//! long as encrypting four blocks); for GCM it also derives the hash subkey,
+//! so SWAESConfigSet() must be called first.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void
+SWAESKey1Set(tSWAESContext *psCtx, const uint32_t *pui32Key,
+             uint32_t ui32Keysize)
+{
+    const uint8_t *pui8Key = (const uint8_t *)pui32Key;
+    uint32_t *pui32RK = psCtx->pui32RoundKey;
+    uint32_t ui32Nk, ui32Idx, ui32T, ui32Rcon;
+
+    //
+    // Check the arguments.
+    //
+    ASSERT((ui32Keysize == AES_CFG_KEY_SIZE_128BIT) ||
+           (ui32Keysize == AES_CFG_KEY_SIZE_192BIT) ||
+           (ui32Keysize == AES_CFG_KEY_SIZE_256BIT));
+
+    ui32Nk = (ui32Keysize == AES_CFG_KEY_SIZE_128BIT) ? 4 :
+             (ui32Keysize == AES_CFG_KEY_SIZE_192BIT) ? 6 : 8;
+    psCtx->ui32Rounds = ui32Nk + 6;
+
+    for(ui32Idx = 0; ui32Idx < ui32Nk; ui32Idx++)
+    {
+        pui32RK[ui32Idx] = LOAD_LE32(pui8Key + (ui32Idx * 4));
+    }
+
+    //
+    // FIPS-197 section 5.2, with the words little-endian: RotWord is a
+    // right rotation and Rcon goes in the low byte.
+    //
+    ui32Rcon = 1;
+    for(ui32Idx = ui32Nk; ui32Idx < (4 * (psCtx->ui32Rounds + 1)); ui32Idx++)
+    {
+        ui32T = pui32RK[ui32Idx - 1];
+        if((ui32Idx % ui32Nk) == 0)
+        {
+            ui32T = ROTL24(ui32T);
+            ui32T = (SBOX(ui32T & 0xff) | (SBOX((ui32T >> 8) & 0xff) << 8) |
+                     (SBOX((ui32T >> 16) & 0xff) << 16) |
+                     (SBOX(ui32T >> 24) << 24)) ^ ui32Rcon;
+            ui32Rcon = (ui32Rcon << 1) ^ ((ui32Rcon & 0x80) ? 0x11b : 0);
+        }
+        else if((ui32Nk == 8) && ((ui32Idx % ui32Nk) == 4))
+        {
+            ui32T = (SBOX(ui32T & 0xff) | (SBOX((ui32T >> 8) & 0xff) << 8) |
+                     (SBOX((ui32T >> 16) & 0xff) << 16) |
+                     (SBOX(ui32T >> 24) << 24));
+        }
+        pui32RK[ui32Idx] = pui32RK[ui32Idx - ui32Nk] ^ ui32T;
+    }
+
+    if((psCtx->ui32Config & AES_CFG_MODE_M) == AES_CFG_MODE_GCM_HY0CALC)
+    {
+        _SWAESGHASHInit(psCtx);
+    }
+}
+
+//*****************************************************************************
+//
+//! Sets the IV of a software AES context.
+//!
+//! \param psCtx is the context.
+//! \param pui32IVdata is the 4-word IV or initial counter block.
+//!
+//! For GCM only the first 12 bytes are used (a 96-bit IV); the counter
+//! block J0 is formed from them as the GCM specification describes.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void
+SWAESIVSet(tSWAESContext *psCtx, const uint32_t *pui32IVdata)
+{
+    const uint8_t *pui8IV = (const uint8_t *)pui32IVdata;
+    uint32_t ui32Idx;
+
+    for(ui32Idx = 0; ui32Idx < 16; ui32Idx++)
+    {
+        psCtx->pui8IV[ui32Idx] = pui8IV[ui32Idx];
+    }
+
+    if((psCtx->ui32Config & AES_CFG_MODE_M) == AES_CFG_MODE_GCM_HY0CALC)
+    {
+        STORE_BE32(psCtx->pui8IV + 12, 1);
+    }
+}
+
+//*****************************************************************************
+//
+//! Reads the IV of a software AES context.
+//!
+//! \param psCtx is the context.
+//! \param pui32IVdata is the 4-word array the IV is written to.
+//!
+//! After a CBC or CTR operation this is the IV that continues the stream,
+//! so a message can be processed in several calls.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void
+SWAESIVRead(tSWAESContext *psCtx, uint32_t *pui32IVdata)
+{
+    uint8_t *pui8IV = (uint8_t *)pui32IVdata;
+    uint32_t ui32Idx;
+
+    for(ui32Idx = 0; ui32Idx < 16; ui32Idx++)
+    {
+        pui8IV[ui32Idx] = psCtx->pui8IV[ui32Idx];
+    }
+}
+
+//*****************************************************************************
+//
+//! Encrypts one 16-byte block with the context's key.
+//!
+//! \param psCtx is the context, with its key set.
+//! \param pui8In is the plaintext block.
+//! \param pui8Out is where the ciphertext block is written; it may be the
+//! same as \e pui8In.
+//!
+//! This is the raw cipher, for building modes this file does not provide.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void
+SWAESBlockEncrypt(const tSWAESContext *psCtx, const uint8_t *pui8In,
+                  uint8_t *pui8Out)
+{
+    const uint32_t *pui32RK = psCtx->pui32RoundKey;
+    uint32_t ui32S0, ui32S1, ui32S2, ui32S3;
+    uint32_t ui32T0, ui32T1, ui32T2, ui32T3;
+    uint32_t ui32Round;
+
+    ui32S0 = LOAD_LE32(pui8In) ^ pui32RK[0];
+    ui32S1 = LOAD_LE32(pui8In + 4) ^ pui32RK[1];
+    ui32S2 = LOAD_LE32(pui8In + 8) ^ pui32RK[2];
+    ui32S3 = LOAD_LE32(pui8In + 12) ^ pui32RK[3];
+
+    //
+    // Two rounds per pass, ping-ponging between S and T so there are no
+    // copies; the last pass stops one round short of the final round.
+    //
+    for(ui32Round = psCtx->ui32Rounds >> 1; ; )
+    {
+        AES_ROUND(ui32T0, ui32T1, ui32T2, ui32T3,
+                  ui32S0, ui32S1, ui32S2, ui32S3, pui32RK + 4);
+        pui32RK += 8;
+        if(--ui32Round == 0)
+        {
+            break;
+        }
+        AES_ROUND(ui32S0, ui32S1, ui32S2, ui32S3,
+                  ui32T0, ui32T1, ui32T2, ui32T3, pui32RK);
+    }
+
+    ui32S0 = AES_FINAL(ui32T0, ui32T1, ui32T2, ui32T3, pui32RK[0]);
+    ui32S1 = AES_FINAL(ui32T1, ui32T2, ui32T3, ui32T0, pui32RK[1]);
+    ui32S2 = AES_FINAL(ui32T2, ui32T3, ui32T0, ui32T1, pui32RK[2]);
+    ui32S3 = AES_FINAL(ui32T3, ui32T0, ui32T1, ui32T2, pui32RK[3]);
+
+    STORE_LE32(pui8Out, ui32S0);
+    STORE_LE32(pui8Out + 4, ui32S1);
+    STORE_LE32(pui8Out + 8, ui32S2);
+    STORE_LE32(pui8Out + 12, ui32S3);
+}
+
+//*****************************************************************************
+//
+// Adds one to the low ui32Bytes bytes of a big-endian counter block.
+//
+//*****************************************************************************
+static void
+_SWAESCounterIncrement(uint8_t *pui8Ctr, uint32_t ui32Bytes)
+{
+    uint8_t *pui8Byte = pui8Ctr + 16;
+
+    while(ui32Bytes--)
+    {
+        if(++*--pui8Byte != 0)
+        {
+            break;
+        }
+    }
+}
+
+//*****************************************************************************
+//
+// CTR keystream over any number of bytes; the last block may be partial, in
+// which case the rest of its keystream is discarded.
+//
+//*****************************************************************************
+static void
+_SWAESCTR(tSWAESContext *psCtx, const uint8_t *pui8Src, uint8_t *pui8Dest,
+          uint32_t ui32Length, uint32_t ui32CtrBytes)
+{
+    uint8_t pui8Stream[16];
+    uint32_t ui32Idx, ui32Block;
+
+    while(ui32Length)
+    {
+        SWAESBlockEncrypt(psCtx, psCtx->pui8IV, pui8Stream);
+        _SWAESCounterIncrement(psCtx->pui8IV, ui32CtrBytes);
+
+        ui32Block = (ui32Length < 16) ? ui32Length : 16;
+        for(ui32Idx = 0; ui32Idx < ui32Block; ui32Idx++)
+        {
+            pui8Dest[ui32Idx] = pui8Src[ui32Idx] ^ pui8Stream[ui32Idx];
+        }
+        pui8Src += ui32Block;
+        pui8Dest += ui32Block;
+        ui32Length -= ui32Block;
+    }
+}
+
+//*****************************************************************************
+//
+// Y = Y.H, Shoup's 4-bit table method: 32 table lookups and shifts.
+//
+//*****************************************************************************
+static void
+_SWAESGHASHMultiply(const tSWAESContext *psCtx, uint8_t *pui8Y)
+{
+    uint64_t ui64Zh, ui64Zl;
+    uint32_t ui32Lo, ui32Hi, ui32Rem;
+    int32_t i32Byte;
+
+    ui32Lo = pui8Y[15] & 0xf;
+    ui64Zh = psCtx->pui64HH[ui32Lo];
+    ui64Zl = psCtx->pui64HL[ui32Lo];
+
+    for(i32Byte = 15; i32Byte >= 0; i32Byte--)
+    {
+        ui32Lo = pui8Y[i32Byte] & 0xf;
+        ui32Hi = pui8Y[i32Byte] >> 4;
+
+        if(i32Byte != 15)
+        {
+            ui32Rem = (uint32_t)ui64Zl & 0xf;
+            ui64Zl = (ui64Zh << 60) | (ui64Zl >> 4);
+            ui64Zh = (ui64Zh >> 4) ^
+                     ((uint64_t)g_pui16GHASHLast4[ui32Rem] << 48);
+            ui64Zh ^= psCtx->pui64HH[ui32Lo];
+            ui64Zl ^= psCtx->pui64HL[ui32Lo];
+        }
+
+        ui32Rem = (uint32_t)ui64Zl & 0xf;
+        ui64Zl = (ui64Zh << 60) | (ui64Zl >> 4);
+        ui64Zh = (ui64Zh >> 4) ^
+                 ((uint64_t)g_pui16GHASHLast4[ui32Rem] << 48);
+        ui64Zh ^= psCtx->pui64HH[ui32Hi];
+        ui64Zl ^= psCtx->pui64HL[ui32Hi];
+    }
+
+    STORE_BE32(pui8Y, (uint32_t)(ui64Zh >> 32));
+    STORE_BE32(pui8Y + 4, (uint32_t)ui64Zh);
+    STORE_BE32(pui8Y + 8, (uint32_t)(ui64Zl >> 32));
+    STORE_BE32(pui8Y + 12, (uint32_t)ui64Zl);
+}
+
+//*****************************************************************************
+//
+// Y = (Y ^ X).H over whole and partial (zero-padded) blocks.
+//
+//*****************************************************************************
+static void
+_SWAESGHASH(const tSWAESContext *psCtx, uint8_t *pui8Y, const uint8_t *pui8X,
+            uint32_t ui32Length)
+{
+    uint32_t ui32Idx, ui32Block;
+
+    while(ui32Length)
+    {
+        ui32Block = (ui32Length < 16) ? ui32Length : 16;
+        for(ui32Idx = 0; ui32Idx < ui32Block; ui32Idx++)
+        {
+            pui8Y[ui32Idx] ^= pui8X[ui32Idx];
+        }
+        pui8X += ui32Block;
+        ui32Length -= ui32Block;
+
+        _SWAESGHASHMultiply(psCtx, pui8Y);
+    }
+}
+
+//*****************************************************************************
+//
+//! Encrypts or decrypts data with a software AES context.
+//!
+//! \param psCtx is the context, with its configuration, key and IV set.
+//! \param pui32Src is the input data.
+//! \param pui32Dest is where the output is written; it may be the same as
+//! \e pui32Src.
+//! \param ui32Length is the length of the data in bytes.
+//!
+//! For ECB and CBC the length must be a multiple of 16.  CTR takes any
+//! length and needs no padding; a partial last block uses up its counter
+//! value.  The IV is advanced as the module's would be, so a long message
+//! can be processed in several calls (with CTR, every call but the last a
+//! multiple of 16 bytes).
+//!
+//! \return Returns \b true if the data was processed, or \b false if the
+//! mode is not supported or the length is not a multiple of 16 for ECB or
+//! CBC.
+//
+//*****************************************************************************
+bool
+SWAESDataProcess(tSWAESContext *psCtx, const uint32_t *pui32Src,
+                 uint32_t *pui32Dest, uint32_t ui32Length)
+{
+    const uint8_t *pui8Src = (const uint8_t *)pui32Src;
+    uint8_t *pui8Dest = (uint8_t *)pui32Dest;
+    uint32_t ui32Mode, ui32Idx;
+
+    ui32Mode = psCtx->ui32Config & AES_CFG_MODE_M;
+
+    if(ui32Mode == AES_CFG_MODE_CTR)
+    {
+        _SWAESCTR(psCtx, pui8Src, pui8Dest, ui32Length,
+                  ((psCtx->ui32Config >> 7) & 3) * 4 + 4);
+        return(true);
+    }
+
+    if(((ui32Mode != AES_CFG_MODE_ECB) && (ui32Mode != AES_CFG_MODE_CBC)) ||
+       !(psCtx->ui32Config & AES_CFG_DIR_ENCRYPT) || (ui32Length & 15))
+    {
+        return(false);
+    }
+
+    for(; ui32Length; ui32Length -= 16)
+    {
+        if(ui32Mode == AES_CFG_MODE_CBC)
+        {
+            for(ui32Idx = 0; ui32Idx < 16; ui32Idx++)
+            {
+                psCtx->pui8IV[ui32Idx] ^= pui8Src[ui32Idx];
+            }
+            SWAESBlockEncrypt(psCtx, psCtx->pui8IV, psCtx->pui8IV);
+            for(ui32Idx = 0; ui32Idx < 16; ui32Idx++)
+            {
+                pui8Dest[ui32Idx] = psCtx->pui8IV[ui32Idx];
+            }
+        }
+        else
+        {
+            SWAESBlockEncrypt(psCtx, pui8Src, pui8Dest);
+        }
+        pui8Src += 16;
+        pui8Dest += 16;
+    }
+
+    return(true);
+}
+
+//*****************************************************************************
+//
+//! Starts an incremental GCM operation.
+//!
+//! \param psCtx is the context, configured for \b AES_CFG_MODE_GCM_HY0CALC,
+//! with its key and IV set.
+//! \param pvAuthSrc is the additional authenticated data.
+//! \param ui32AuthLength is the length of the additional authenticated data
+//! in bytes; it may be zero.
+//!
+//! SWAESGCMStart(), any number of SWAESGCMUpdate() calls and
+//! SWAESGCMFinish() give the same output and tag as one
+//! SWAESDataProcessAuth() call over the concatenated data, so a stream of
+//! any length can be processed with the RAM of one context.  The additional
+//! authenticated data is all given here.
+//!
+//! \return Returns \b true if the operation was started, or \b false if the
+//! context is not configured for GCM.
+//
+//*****************************************************************************
+bool
+SWAESGCMStart(tSWAESContext *psCtx, const void *pvAuthSrc,
+              uint32_t ui32AuthLength)
+{
+    uint32_t ui32Idx;
+
+    if((psCtx->ui32Config & AES_CFG_MODE_M) != AES_CFG_MODE_GCM_HY0CALC)
+    {
+        return(false);
+    }
+
+    //
+    // E(K, J0) masks the tag; the data counter starts at J0 + 1.
+    //
+    SWAESBlockEncrypt(psCtx, psCtx->pui8IV, psCtx->pui8EJ0);
+    _SWAESCounterIncrement(psCtx->pui8IV, 4);
+
+    for(ui32Idx = 0; ui32Idx < 16; ui32Idx++)
+    {
+        psCtx->pui8GHASH[ui32Idx] = 0;
+    }
+    _SWAESGHASH(psCtx, psCtx->pui8GHASH, (const uint8_t *)pvAuthSrc,
+                ui32AuthLength);
+    psCtx->ui32AuthLength = ui32AuthLength;
+    psCtx->ui32Length = 0;
+
+    return(true);
+}
+
+//*****************************************************************************
+//
+//! Encrypts or decrypts the next part of an incremental GCM operation.
+//!
+//! \param psCtx is the context, started with SWAESGCMStart().
+//! \param pvSrc is the input data, at any alignment.
+//! \param pvDest is where the output is written; it may be the same as
+//! \e pvSrc.
+//! \param ui32Length is the length of the data in bytes; any length,
+//! including zero.
+//!
+//! A partial block is carried to the next call, both its keystream and its
+//! hash input, so the chunks need not be multiples of 16 bytes.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void
+SWAESGCMUpdate(tSWAESContext *psCtx, const void *pvSrc, void *pvDest,
+               uint32_t ui32Length)
+{
+    const uint8_t *pui8Src = (const uint8_t *)pvSrc;
+    uint8_t *pui8Dest = (uint8_t *)pvDest;
+    uint8_t *pui8Y = psCtx->pui8GHASH;
+    uint8_t *pui8Stream = psCtx->pui8Stream;
+    uint32_t ui32Off, ui32Idx, ui32Block;
+    uint8_t ui8In, ui8Out;
+    bool bEncrypt;
+
+    bEncrypt = (psCtx->ui32Config & AES_CFG_DIR_ENCRYPT) != 0;
+
+    while(ui32Length)
+    {
+        ui32Off = psCtx->ui32Length & 15;
+        if(ui32Off == 0)
+        {
+            SWAESBlockEncrypt(psCtx, psCtx->pui8IV, pui8Stream);
+            _SWAESCounterIncrement(psCtx->pui8IV, 4);
+        }
+
+        ui32Block = 16 - ui32Off;
+        if(ui32Block > ui32Length)
+        {
+            ui32Block = ui32Length;
+        }
+
+        //
+        // The hash is always over the ciphertext: the output when
+        // encrypting, the input when decrypting.  The input byte is read
+        // first so that the data may be processed in place.
+        //
+        for(ui32Idx = ui32Off; ui32Idx < (ui32Off + ui32Block); ui32Idx++)
+        {
+            ui8In = *pui8Src++;
+            ui8Out = ui8In ^ pui8Stream[ui32Idx];
+            *pui8Dest++ = ui8Out;
+            pui8Y[ui32Idx] ^= bEncrypt ? ui8Out : ui8In;
+        }
+
+        psCtx->ui32Length += ui32Block;
+        ui32Length -= ui32Block;
+        if((psCtx->ui32Length & 15) == 0)
+        {
+            _SWAESGHASHMultiply(psCtx, pui8Y);
+        }
+    }
+}
+
+//*****************************************************************************
+//
+//! Finishes an incremental GCM operation and writes the tag.
+//!
+//! \param psCtx is the context.
+//! \param pui32Tag is the 4-word array the tag is written to.
+//!
+//! When decrypting, compare the tag written here with the received tag (in
+//! constant time) and discard the output if they differ.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void
+SWAESGCMFinish(tSWAESContext *psCtx, uint32_t *pui32Tag)
+{
+    uint8_t pui8Lengths[16];
+    uint8_t *pui8Tag = (uint8_t *)pui32Tag;
+    uint32_t ui32Idx;
+
+    //
+    // A partial last block is already in the hash, zero padded.
+    //
+    if(psCtx->ui32Length & 15)
+    {
+        _SWAESGHASHMultiply(psCtx, psCtx->pui8GHASH);
+    }
+
+    //
+    // The bit lengths of the AAD and the data close the hash.
+    //
+    STORE_BE32(pui8Lengths, psCtx->ui32AuthLength >> 29);
+    STORE_BE32(pui8Lengths + 4, psCtx->ui32AuthLength << 3);
+    STORE_BE32(pui8Lengths + 8, psCtx->ui32Length >> 29);
+    STORE_BE32(pui8Lengths + 12, psCtx->ui32Length << 3);
+    _SWAESGHASH(psCtx, psCtx->pui8GHASH, pui8Lengths, 16);
+
+    for(ui32Idx = 0; ui32Idx < 16; ui32Idx++)
+    {
+        pui8Tag[ui32Idx] = psCtx->pui8GHASH[ui32Idx] ^ psCtx->pui8EJ0[ui32Idx];
+    }
+}
+
+//*****************************************************************************
+//
+//! Encrypts or decrypts and authenticates data with a software AES context
+//! in GCM mode.
+//!
+//! \param psCtx is the context, configured for \b AES_CFG_MODE_GCM_HY0CALC,
+//! with its key and IV set.
+//! \param pui32Src is the input data.
+//! \param pui32Dest is where the output is written; it may be the same as
+//! \e pui32Src.
+//! \param ui32Length is the length of the data in bytes.
+//! \param pui32AuthSrc is the additional authenticated data.
+//! \param ui32AuthLength is the length of the additional authenticated data
+//! in bytes.
+//! \param pui32Tag is the 4-word array the tag is written to.
+//!
+//! Neither the data nor the additional authenticated data needs padding.
+//! When decrypting, compare the tag written here with the received tag (in
+//! constant time) and discard the output if they differ.  Each call is one
+//! complete message under the IV set with SWAESIVSet(); never reuse an IV
+//! with the same key.
+//!
+//! \return Returns \b true if the data was processed, or \b false if the
+//! context is not configured for GCM.
+//
+//*****************************************************************************
+bool
+SWAESDataProcessAuth(tSWAESContext *psCtx, const uint32_t *pui32Src,
+                     uint32_t *pui32Dest, uint32_t ui32Length,
+                     const uint32_t *pui32AuthSrc, uint32_t ui32AuthLength,
+                     uint32_t *pui32Tag)
+{
+    if(!SWAESGCMStart(psCtx, pui32AuthSrc, ui32AuthLength))
+    {
+        return(false);
+    }
+    SWAESGCMUpdate(psCtx, pui32Src, pui32Dest, ui32Length);
+    SWAESGCMFinish(psCtx, pui32Tag);
+
+    return(true);
+}
+
+//*****************************************************************************
+//
+// Close the Doxygen group.
+//! @}
+//
+//*****************************************************************************
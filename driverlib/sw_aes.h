@@ -0,0 +1,118 @@
+//*****************************************************************************
+//
+// sw_aes.h - Prototypes for the software AES (ECB, CBC, CTR and GCM)
+//            functions.
+//
+// A software stand-in for the AES module on parts that have none, such as
+// the TM4C123.  The calls have the shape of AESConfigSet(), AESKey1Set(),
+// AESIVSet(), AESDataProcess() and AESDataProcessAuth(), with a context
+// pointer in place of the module base address, and take the same
+// AES_CFG_* configuration values from aes.h.
+//
+// Author      : Jithin B.P.
+// Affiliation : CSpark Research
+// Email       : jithinuser@gmail.com
+//
+// License     : This source code is released under an open-source license.
+// You may use, modify, and distribute it freely, provided that proper
+// attribution is given to the original author.
+//
+// Created     : 2025
+//
+//*****************************************************************************
+
+#ifndef __DRIVERLIB_SW_AES_H__
+#define __DRIVERLIB_SW_AES_H__
+
+#include "driverlib/aes.h"
+
+//*****************************************************************************
+//
+// If building with a C++ compiler, make all of the definitions in this header
+// have a C binding.
+//
+//*****************************************************************************
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+//*****************************************************************************
+//
+// The state of one software AES "module".  The fields are private to
+// sw_aes.c; a context is 576 bytes.
+//
+//*****************************************************************************
+typedef struct
+{
+    //
+    // The expanded key, 4 * (rounds + 1) words.
+    //
+    uint32_t pui32RoundKey[60];
+    uint32_t ui32Rounds;
+
+    //
+    // The AES_CFG_* value from SWAESConfigSet().
+    //
+    uint32_t ui32Config;
+
+    //
+    // The IV or counter block, updated as data is processed, as the module's
+    // IV registers are.
+    //
+    uint8_t pui8IV[16];
+
+    //
+    // GCM: the hash subkey H multiplied by 0..15, for 4-bit table GHASH.
+    //
+    uint64_t pui64HL[16];
+    uint64_t pui64HH[16];
+
+    //
+    // GCM in progress: the hash so far, E(K, J0) for the tag, the keystream
+    // block in use and the lengths.
+    //
+    uint8_t pui8GHASH[16];
+    uint8_t pui8EJ0[16];
+    uint8_t pui8Stream[16];
+    uint32_t ui32AuthLength;
+    uint32_t ui32Length;
+}
+tSWAESContext;
+
+//*****************************************************************************
+//
+// Prototypes for the functions.
+//
+//*****************************************************************************
+extern void SWAESConfigSet(tSWAESContext *psCtx, uint32_t ui32Config);
+extern void SWAESKey1Set(tSWAESContext *psCtx, const uint32_t *pui32Key,
+                         uint32_t ui32Keysize);
+extern void SWAESIVSet(tSWAESContext *psCtx, const uint32_t *pui32IVdata);
+extern void SWAESIVRead(tSWAESContext *psCtx, uint32_t *pui32IVdata);
+extern void SWAESBlockEncrypt(const tSWAESContext *psCtx,
+                              const uint8_t *pui8In, uint8_t *pui8Out);
+extern bool SWAESDataProcess(tSWAESContext *psCtx, const uint32_t *pui32Src,
+                             uint32_t *pui32Dest, uint32_t ui32Length);
+extern bool SWAESDataProcessAuth(tSWAESContext *psCtx,
+                                 const uint32_t *pui32Src,
+                                 uint32_t *pui32Dest, uint32_t ui32Length,
+                                 const uint32_t *pui32AuthSrc,
+                                 uint32_t ui32AuthLength,
+                                 uint32_t *pui32Tag);
+extern bool SWAESGCMStart(tSWAESContext *psCtx, const void *pvAuthSrc,
+                          uint32_t ui32AuthLength);
+extern void SWAESGCMUpdate(tSWAESContext *psCtx, const void *pvSrc,
+                           void *pvDest, uint32_t ui32Length);
+extern void SWAESGCMFinish(tSWAESContext *psCtx, uint32_t *pui32Tag);
+
+//*****************************************************************************
+//
+// Mark the end of the C bindings section for C++ compilers.
+//
+//*****************************************************************************
+#ifdef __cplusplus
+}
+#endif
+
+#endif // __DRIVERLIB_SW_AES_H__
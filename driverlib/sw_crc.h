@@ -51,6 +51,18 @@ extern "C"
 {
 #endif
 
+//*****************************************************************************
+//
+// The number of CRC-32 slicing tables built into the library: 1 (the plain
+// byte-wise table only), 4 (adds 3 KB for Crc32Slice4()) or 8 (adds 7 KB for
+// Crc32Slice8()).  Crc32Slice4() and Crc32Slice8() are always available and
+// fall back to the widest variant the tables allow.
+//
+//*****************************************************************************
+#ifndef SW_CRC32_SLICE
+#define SW_CRC32_SLICE          8
+#endif
+
 //*****************************************************************************
 //
 // Prototypes for the functions.
@@ -63,8 +75,14 @@ extern uint16_t Crc16(uint16_t ui16Crc, const uint8_t *pui8Data,
 extern uint16_t Crc16Array(uint32_t ui32WordLen, const uint32_t *pui32Data);
 extern void Crc16Array3(uint32_t ui32WordLen, const uint32_t *pui32Data,
                         uint16_t *pui16Crc3);
+extern void Crc16Lanes(uint32_t ui32Lanes, uint16_t *pui16Crc,
+                       const uint8_t * const *ppui8Data, uint32_t ui32Count);
 extern uint32_t Crc32(uint32_t ui32Crc, const uint8_t *pui8Data,
                       uint32_t ui32Count);
+extern uint32_t Crc32Slice4(uint32_t ui32Crc, const uint8_t *pui8Data,
+                            uint32_t ui32Count);
+extern uint32_t Crc32Slice8(uint32_t ui32Crc, const uint8_t *pui8Data,
+                            uint32_t ui32Count);
 
 //*****************************************************************************
 //
@@ -0,0 +1,492 @@
+//*****************************************************************************
+//
+// sw_shamd5.c - Software SHA-224/SHA-256 and HMAC for parts without the
+//               SHA/MD5 module.
+//
+// Author      : Jithin B.P.
+// Affiliation : CSpark Research
+// Email       : jithinuser@gmail.com
+//
+// License     : This source code is released under an open-source license.
+// You may use, modify, and distribute it freely, provided that proper
+// attribution is given to the original author.
+//
+// Created     : 2025
+//
+//*****************************************************************************
+
+//*****************************************************************************
+//
+//! \addtogroup sw_shamd5_api
+//! @{
+//
+//*****************************************************************************
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "driverlib/debug.h"
+#include "driverlib/sw_shamd5.h"
+
+//*****************************************************************************
+//
+// The SHA-224 and SHA-256 members of the SHAMD5_ALGO_* values (plain and
+// HMAC) differ from each other, and from MD5 and SHA-1, in bits 1 and 2;
+// bit 4 is set for a plain hash and clear for an HMAC.
+//
+//*****************************************************************************
+#define SW_SHA_ALGO_M           0x00000006
+#define SW_SHA_ALGO_SHA224      0x00000004
+#define SW_SHA_ALGO_SHA256      0x00000006
+#define SW_SHA_ALGO_HASH        0x00000010
+
+//*****************************************************************************
+//
+// The SHA-256 round constants (FIPS 180-4 section 4.2.2).
+//
+//*****************************************************************************
+static const uint32_t g_pui32SHA256K[64] =
+{
+    0x428a2f98, 0x71374491, 0xb5c0fbcf, 0xe9b5dba5,
+    0x3956c25b, 0x59f111f1, 0x923f82a4, 0xab1c5ed5,
+    0xd807aa98, 0x12835b01, 0x243185be, 0x550c7dc3,
+    0x72be5d74, 0x80deb1fe, 0x9bdc06a7, 0xc19bf174,
+    0xe49b69c1, 0xefbe4786, 0x0fc19dc6, 0x240ca1cc,
+    0x2de92c6f, 0x4a7484aa, 0x5cb0a9dc, 0x76f988da,
+    0x983e5152, 0xa831c66d, 0xb00327c8, 0xbf597fc7,
+    0xc6e00bf3, 0xd5a79147, 0x06ca6351, 0x14292967,
+    0x27b70a85, 0x2e1b2138, 0x4d2c6dfc, 0x53380d13,
+    0x650a7354, 0x766a0abb, 0x81c2c92e, 0x92722c85,
+    0xa2bfe8a1, 0xa81a664b, 0xc24b8b70, 0xc76c51a3,
+    0xd192e819, 0xd6990624, 0xf40e3585, 0x106aa070,
+    0x19a4c116, 0x1e376c08, 0x2748774c, 0x34b0bcb5,
+    0x391c0cb3, 0x4ed8aa4a, 0x5b9cca4f, 0x682e6ff3,
+    0x748f82ee, 0x78a5636f, 0x84c87814, 0x8cc70208,
+    0x90befffa, 0xa4506ceb, 0xbef9a3f7, 0xc67178f2
+};
+
+//*****************************************************************************
+//
+// The initial hash values for SHA-256 and SHA-224 (sections 5.3.3 and
+// 5.3.2).
+//
+//*****************************************************************************
+static const uint32_t g_pui32SHA256H0[8] =
+{
+    0x6a09e667, 0xbb67ae85, 0x3c6ef372, 0xa54ff53a,
+    0x510e527f, 0x9b05688c, 0x1f83d9ab, 0x5be0cd19
+};
+static const uint32_t g_pui32SHA224H0[8] =
+{
+    0xc1059ed8, 0x367cd507, 0x3070dd17, 0xf70e5939,
+    0xffc00b31, 0x68581511, 0x64f98fa7, 0xbefa4fa4
+};
+
+//*****************************************************************************
+//
+// The SHA-256 functions (section 4.1.2).  The rotates become single ROR
+// operands on the Cortex-M4, and CH and MAJ are in their two-operation
+// forms.
+//
+//*****************************************************************************
+#define ROTR(x, n)              (((x) >> (n)) | ((x) << (32 - (n))))
+#define SHA256_CH(x, y, z)      ((z) ^ ((x) & ((y) ^ (z))))
+#define SHA256_MAJ(x, y, z)     (((x) & (y)) | ((z) & ((x) | (y))))
+#define SHA256_SIGMA0(x)        (ROTR(x, 2) ^ ROTR(x, 13) ^ ROTR(x, 22))
+#define SHA256_SIGMA1(x)        (ROTR(x, 6) ^ ROTR(x, 11) ^ ROTR(x, 25))
+#define SHA256_sigma0(x)        (ROTR(x, 7) ^ ROTR(x, 18) ^ ((x) >> 3))
+#define SHA256_sigma1(x)        (ROTR(x, 17) ^ ROTR(x, 19) ^ ((x) >> 10))
+
+#define LOAD_BE32(p)                                                          \
+        (((uint32_t)(p)[0] << 24) | ((uint32_t)(p)[1] << 16) |                \
+         ((uint32_t)(p)[2] << 8) | (uint32_t)(p)[3])
+
+//*****************************************************************************
+//
+// One round.  Instead of shifting the eight working variables along, the
+// callers rotate the names, so a round is only the two additions into d and
+// h; eight rounds bring the names back where they started.
+//
+//*****************************************************************************
+#define SHA256_ROUND(a, b, c, d, e, f, g, h, i)                               \
+        do                                                                    \
+        {                                                                     \
+            ui32T = h + SHA256_SIGMA1(e) + SHA256_CH(e, f, g) +               \
+                    g_pui32SHA256K[i] + pui32W[(i) & 15];                     \
+            d += ui32T;                                                       \
+            h = ui32T + SHA256_SIGMA0(a) + SHA256_MAJ(a, b, c);               \
+        }                                                                     \
+        while(0)
+
+#define SHA256_ROUND8(i)                                                      \
+        do                                                                    \
+        {                                                                     \
+            SHA256_ROUND(ui32A, ui32B, ui32C, ui32D,                          \
+                         ui32E, ui32F, ui32G, ui32H, (i) + 0);                \
+            SHA256_ROUND(ui32H, ui32A, ui32B, ui32C,                          \
+                         ui32D, ui32E, ui32F, ui32G, (i) + 1);                \
+            SHA256_ROUND(ui32G, ui32H, ui32A, ui32B,                          \
+                         ui32C, ui32D, ui32E, ui32F, (i) + 2);                \
+            SHA256_ROUND(ui32F, ui32G, ui32H, ui32A,                          \
+                         ui32B, ui32C, ui32D, ui32E, (i) + 3);                \
+            SHA256_ROUND(ui32E, ui32F, ui32G, ui32H,                          \
+                         ui32A, ui32B, ui32C, ui32D, (i) + 4);                \
+            SHA256_ROUND(ui32D, ui32E, ui32F, ui32G,                          \
+                         ui32H, ui32A, ui32B, ui32C, (i) + 5);                \
+            SHA256_ROUND(ui32C, ui32D, ui32E, ui32F,                          \
+                         ui32G, ui32H, ui32A, ui32B, (i) + 6);                \
+            SHA256_ROUND(ui32B, ui32C, ui32D, ui32E,                          \
+                         ui32F, ui32G, ui32H, ui32A, (i) + 7);                \
+        }                                                                     \
+        while(0)
+
+//*****************************************************************************
+//
+// The message schedule is kept as a 16-word ring, updated in place.
+//
+//*****************************************************************************
+#define SHA256_SCHEDULE(i)                                                    \
+        (pui32W[(i) & 15] += SHA256_sigma1(pui32W[((i) - 2) & 15]) +          \
+                             pui32W[((i) - 7) & 15] +                         \
+                             SHA256_sigma0(pui32W[((i) - 15) & 15]))
+
+//*****************************************************************************
+//
+// Compresses ui32Blocks 64-byte blocks, straight from the caller's buffer
+// (any alignment), into the state.
+//
+//*****************************************************************************
+static void
+_SWSHA256Compress(uint32_t *pui32State, const uint8_t *pui8Data,
+                  uint32_t ui32Blocks)
+{
+    uint32_t ui32A, ui32B, ui32C, ui32D, ui32E, ui32F, ui32G, ui32H;
+    uint32_t pui32W[16], ui32T, ui32Idx;
+
+    while(ui32Blocks--)
+    {
+        for(ui32Idx = 0; ui32Idx < 16; ui32Idx++)
+        {
+            pui32W[ui32Idx] = LOAD_BE32(pui8Data + (ui32Idx * 4));
+        }
+        pui8Data += 64;
+
+        ui32A = pui32State[0];
+        ui32B = pui32State[1];
+        ui32C = pui32State[2];
+        ui32D = pui32State[3];
+        ui32E = pui32State[4];
+        ui32F = pui32State[5];
+        ui32G = pui32State[6];
+        ui32H = pui32State[7];
+
+        SHA256_ROUND8(0);
+        SHA256_ROUND8(8);
+
+        //
+        // The eight schedule words a pass needs depend only on earlier
+        // words, so they are all computed before its rounds.
+        //
+        for(ui32Idx = 16; ui32Idx < 64; ui32Idx += 8)
+        {
+            SHA256_SCHEDULE(ui32Idx + 0);
+            SHA256_SCHEDULE(ui32Idx + 1);
+            SHA256_SCHEDULE(ui32Idx + 2);
+            SHA256_SCHEDULE(ui32Idx + 3);
+            SHA256_SCHEDULE(ui32Idx + 4);
+            SHA256_SCHEDULE(ui32Idx + 5);
+            SHA256_SCHEDULE(ui32Idx + 6);
+            SHA256_SCHEDULE(ui32Idx + 7);
+            SHA256_ROUND8(ui32Idx);
+        }
+
+        pui32State[0] += ui32A;
+        pui32State[1] += ui32B;
+        pui32State[2] += ui32C;
+        pui32State[3] += ui32D;
+        pui32State[4] += ui32E;
+        pui32State[5] += ui32F;
+        pui32State[6] += ui32G;
+        pui32State[7] += ui32H;
+    }
+}
+
+//*****************************************************************************
+//
+//! Starts an incremental hash with a software SHA context.
+//!
+//! \param psCtx is the context, configured with SWSHAMD5ConfigSet().
+//!
+//! SWSHAMD5HashStart(), any number of SWSHAMD5HashUpdate() calls and
+//! SWSHAMD5HashFinish() give the same digest as one SWSHAMD5DataProcess()
+//! call over the concatenated data, without the whole message ever being in
+//! memory.  Between calls the context holds the chaining state and up to 63
+//! bytes of unhashed data; nothing points into the caller's buffers.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void
+SWSHAMD5HashStart(tSWSHAMD5Context *psCtx)
+{
+    const uint32_t *pui32H0;
+    uint32_t ui32Idx;
+
+    pui32H0 = ((psCtx->ui32Mode & SW_SHA_ALGO_M) == SW_SHA_ALGO_SHA224) ?
+              g_pui32SHA224H0 : g_pui32SHA256H0;
+    for(ui32Idx = 0; ui32Idx < 8; ui32Idx++)
+    {
+        psCtx->pui32State[ui32Idx] = pui32H0[ui32Idx];
+    }
+    psCtx->ui32Count = 0;
+    psCtx->ui64Length = 0;
+}
+
+//*****************************************************************************
+//
+//! Adds data to an incremental hash.
+//!
+//! \param psCtx is the context, started with SWSHAMD5HashStart().
+//! \param pvData is the data, at any alignment.
+//! \param ui32Length is the length of the data in bytes; any length,
+//! including zero.
+//!
+//! Whole blocks are compressed straight from \e pvData; only a partial
+//! block at either end is copied into the context.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void
+SWSHAMD5HashUpdate(tSWSHAMD5Context *psCtx, const void *pvData,
+                   uint32_t ui32Length)
+{
+    const uint8_t *pui8Data = (const uint8_t *)pvData;
+    uint32_t ui32Fill;
+
+    psCtx->ui64Length += ui32Length;
+
+    if(psCtx->ui32Count)
+    {
+        ui32Fill = 64 - psCtx->ui32Count;
+        if(ui32Length < ui32Fill)
+        {
+            ui32Fill = ui32Length;
+        }
+        ui32Length -= ui32Fill;
+        while(ui32Fill--)
+        {
+            psCtx->pui8Block[psCtx->ui32Count++] = *pui8Data++;
+        }
+        if(psCtx->ui32Count < 64)
+        {
+            return;
+        }
+        _SWSHA256Compress(psCtx->pui32State, psCtx->pui8Block, 1);
+        psCtx->ui32Count = 0;
+    }
+
+    _SWSHA256Compress(psCtx->pui32State, pui8Data, ui32Length / 64);
+    pui8Data += ui32Length & ~63;
+    ui32Length &= 63;
+
+    while(ui32Length--)
+    {
+        psCtx->pui8Block[psCtx->ui32Count++] = *pui8Data++;
+    }
+}
+
+//*****************************************************************************
+//
+//! Finishes an incremental hash and writes the digest.
+//!
+//! \param psCtx is the context.
+//! \param pui32HashResult is the array the digest is written to: 7 words
+//! for SHA-224, 8 for SHA-256, in the byte order of the standard's hex
+//! digest.
+//!
+//! The context must be started again before it is reused.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void
+SWSHAMD5HashFinish(tSWSHAMD5Context *psCtx, uint32_t *pui32HashResult)
+{
+    uint8_t *pui8Digest = (uint8_t *)pui32HashResult;
+    uint64_t ui64Bits;
+    uint32_t ui32Idx, ui32Words;
+
+    ui64Bits = psCtx->ui64Length << 3;
+
+    psCtx->pui8Block[psCtx->ui32Count++] = 0x80;
+    if(psCtx->ui32Count > 56)
+    {
+        while(psCtx->ui32Count < 64)
+        {
+            psCtx->pui8Block[psCtx->ui32Count++] = 0;
+        }
+        _SWSHA256Compress(psCtx->pui32State, psCtx->pui8Block, 1);
+        psCtx->ui32Count = 0;
+    }
+    while(psCtx->ui32Count < 56)
+    {
+        psCtx->pui8Block[psCtx->ui32Count++] = 0;
+    }
+    for(ui32Idx = 0; ui32Idx < 8; ui32Idx++)
+    {
+        psCtx->pui8Block[56 + ui32Idx] = (uint8_t)(ui64Bits >>
+                                                   (56 - (ui32Idx * 8)));
+    }
+    _SWSHA256Compress(psCtx->pui32State, psCtx->pui8Block, 1);
+    psCtx->ui32Count = 0;
+
+    ui32Words = ((psCtx->ui32Mode & SW_SHA_ALGO_M) == SW_SHA_ALGO_SHA224) ?
+                7 : 8;
+    for(ui32Idx = 0; ui32Idx < ui32Words; ui32Idx++)
+    {
+        pui8Digest[0] = (uint8_t)(psCtx->pui32State[ui32Idx] >> 24);
+        pui8Digest[1] = (uint8_t)(psCtx->pui32State[ui32Idx] >> 16);
+        pui8Digest[2] = (uint8_t)(psCtx->pui32State[ui32Idx] >> 8);
+        pui8Digest[3] = (uint8_t)psCtx->pui32State[ui32Idx];
+        pui8Digest += 4;
+    }
+}
+
+//*****************************************************************************
+//
+//! Configures a software SHA context.
+//!
+//! \param psCtx is the context to configure.
+//! \param ui32Mode is one of \b SHAMD5_ALGO_SHA224, \b SHAMD5_ALGO_SHA256,
+//! \b SHAMD5_ALGO_HMAC_SHA224 or \b SHAMD5_ALGO_HMAC_SHA256.
+//!
+//! MD5 and SHA-1 are not provided.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void
+SWSHAMD5ConfigSet(tSWSHAMD5Context *psCtx, uint32_t ui32Mode)
+{
+    //
+    // Check the arguments.
+    //
+    ASSERT((ui32Mode == SHAMD5_ALGO_SHA224) ||
+           (ui32Mode == SHAMD5_ALGO_SHA256) ||
+           (ui32Mode == SHAMD5_ALGO_HMAC_SHA224) ||
+           (ui32Mode == SHAMD5_ALGO_HMAC_SHA256));
+
+    psCtx->ui32Mode = ui32Mode;
+}
+
+//*****************************************************************************
+//
+//! Computes the hash of an array of data with a software SHA context.
+//!
+//! \param psCtx is the context, configured with SWSHAMD5ConfigSet().
+//! \param pui32DataSrc is the data to hash.
+//! \param ui32DataLength is the length of the data in bytes.
+//! \param pui32HashResult is the array the digest is written to: 7 words
+//! for SHA-224, 8 for SHA-256.
+//!
+//! Unlike the module, any length and any alignment is accepted.  The digest
+//! bytes are in the order of the standard's hex digest.  In either HMAC
+//! mode this is the plain hash of the same SHA variant.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void
+SWSHAMD5DataProcess(tSWSHAMD5Context *psCtx, const uint32_t *pui32DataSrc,
+                    uint32_t ui32DataLength, uint32_t *pui32HashResult)
+{
+    SWSHAMD5HashStart(psCtx);
+    SWSHAMD5HashUpdate(psCtx, pui32DataSrc, ui32DataLength);
+    SWSHAMD5HashFinish(psCtx, pui32HashResult);
+}
+
+//*****************************************************************************
+//
+//! Sets the HMAC key of a software SHA context.
+//!
+//! \param psCtx is the context.
+//! \param pui32Src is the 16-word (64-byte) key.
+//!
+//! As with SHAMD5HMACKeySet(), a shorter key must be padded with zeros;
+//! a longer one must first be hashed and the digest padded.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void
+SWSHAMD5HMACKeySet(tSWSHAMD5Context *psCtx, const uint32_t *pui32Src)
+{
+    const uint8_t *pui8Key = (const uint8_t *)pui32Src;
+    uint32_t ui32Idx;
+
+    for(ui32Idx = 0; ui32Idx < 64; ui32Idx++)
+    {
+        psCtx->pui8HMACKey[ui32Idx] = pui8Key[ui32Idx];
+    }
+}
+
+//*****************************************************************************
+//
+//! Computes an HMAC with a software SHA context.
+//!
+//! \param psCtx is the context, configured with \b SHAMD5_ALGO_HMAC_SHA224
+//! or \b SHAMD5_ALGO_HMAC_SHA256 and with its key set.
+//! \param pui32DataSrc is the data to authenticate.
+//! \param ui32DataLength is the length of the data in bytes.
+//! \param pui32HashResult is the array the HMAC is written to: 7 words for
+//! SHA-224, 8 for SHA-256.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void
+SWSHAMD5HMACProcess(tSWSHAMD5Context *psCtx, const uint32_t *pui32DataSrc,
+                    uint32_t ui32DataLength, uint32_t *pui32HashResult)
+{
+    uint32_t pui32Inner[8];
+    uint8_t pui8Pad[64];
+    uint32_t ui32Idx;
+
+    //
+    // Check the arguments.
+    //
+    ASSERT(!(psCtx->ui32Mode & SW_SHA_ALGO_HASH));
+
+    //
+    // H((K ^ ipad) || message)
+    //
+    for(ui32Idx = 0; ui32Idx < 64; ui32Idx++)
+    {
+        pui8Pad[ui32Idx] = psCtx->pui8HMACKey[ui32Idx] ^ 0x36;
+    }
+    SWSHAMD5HashStart(psCtx);
+    SWSHAMD5HashUpdate(psCtx, pui8Pad, 64);
+    SWSHAMD5HashUpdate(psCtx, pui32DataSrc, ui32DataLength);
+    SWSHAMD5HashFinish(psCtx, pui32Inner);
+
+    //
+    // H((K ^ opad) || inner hash)
+    //
+    for(ui32Idx = 0; ui32Idx < 64; ui32Idx++)
+    {
+        pui8Pad[ui32Idx] = psCtx->pui8HMACKey[ui32Idx] ^ 0x5c;
+    }
+    SWSHAMD5HashStart(psCtx);
+    SWSHAMD5HashUpdate(psCtx, pui8Pad, 64);
+    SWSHAMD5HashUpdate(psCtx, pui32Inner,
+                    ((psCtx->ui32Mode & SW_SHA_ALGO_M) ==
+                     SW_SHA_ALGO_SHA224) ? 28 : 32);
+    SWSHAMD5HashFinish(psCtx, pui32HashResult);
+}
+
+//*****************************************************************************
+//
+// Close the Doxygen group.
+//! @}
+//
+//*****************************************************************************
@@ -0,0 +1,104 @@
+//*****************************************************************************
+//
+// sw_shamd5.h - Prototypes for the software SHA-224/SHA-256 and HMAC
+//               functions.
+//
+// A software stand-in for the SHA/MD5 module on parts that have none, such
+// as the TM4C123.  The calls have the shape of SHAMD5ConfigSet(),
+// SHAMD5DataProcess(), SHAMD5HMACKeySet() and SHAMD5HMACProcess(), with a
+// context pointer in place of the module base address, and take the
+// SHAMD5_ALGO_* values from shamd5.h.  Only the SHA-2 algorithms are
+// provided.
+//
+// Author      : Jithin B.P.
+// Affiliation : CSpark Research
+// Email       : jithinuser@gmail.com
+//
+// License     : This source code is released under an open-source license.
+// You may use, modify, and distribute it freely, provided that proper
+// attribution is given to the original author.
+//
+// Created     : 2025
+//
+//*****************************************************************************
+
+#ifndef __DRIVERLIB_SW_SHAMD5_H__
+#define __DRIVERLIB_SW_SHAMD5_H__
+
+#include "driverlib/shamd5.h"
+
+//*****************************************************************************
+//
+// If building with a C++ compiler, make all of the definitions in this header
+// have a C binding.
+//
+//*****************************************************************************
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+//*****************************************************************************
+//
+// The state of one software SHA "module".  The fields are private to
+// sw_shamd5.c.
+//
+//*****************************************************************************
+typedef struct
+{
+    //
+    // The chaining state, A to H.
+    //
+    uint32_t pui32State[8];
+
+    //
+    // The message bytes not yet compressed, and the total length so far.
+    //
+    uint8_t pui8Block[64];
+    uint32_t ui32Count;
+    uint64_t ui64Length;
+
+    //
+    // The SHAMD5_ALGO_* value from SWSHAMD5ConfigSet().
+    //
+    uint32_t ui32Mode;
+
+    //
+    // The HMAC key from SWSHAMD5HMACKeySet(), zero padded to a block.
+    //
+    uint8_t pui8HMACKey[64];
+}
+tSWSHAMD5Context;
+
+//*****************************************************************************
+//
+// Prototypes for the functions.
+//
+//*****************************************************************************
+extern void SWSHAMD5ConfigSet(tSWSHAMD5Context *psCtx, uint32_t ui32Mode);
+extern void SWSHAMD5DataProcess(tSWSHAMD5Context *psCtx,
+                                const uint32_t *pui32DataSrc,
+                                uint32_t ui32DataLength,
+                                uint32_t *pui32HashResult);
+extern void SWSHAMD5HashStart(tSWSHAMD5Context *psCtx);
+extern void SWSHAMD5HashUpdate(tSWSHAMD5Context *psCtx, const void *pvData,
+                               uint32_t ui32Length);
+extern void SWSHAMD5HashFinish(tSWSHAMD5Context *psCtx,
+                               uint32_t *pui32HashResult);
+extern void SWSHAMD5HMACKeySet(tSWSHAMD5Context *psCtx,
+                               const uint32_t *pui32Src);
+extern void SWSHAMD5HMACProcess(tSWSHAMD5Context *psCtx,
+                                const uint32_t *pui32DataSrc,
+                                uint32_t ui32DataLength,
+                                uint32_t *pui32HashResult);
+
+//*****************************************************************************
+//
+// Mark the end of the C bindings section for C++ compilers.
+//
+//*****************************************************************************
+#ifdef __cplusplus
+}
+#endif
+
+#endif // __DRIVERLIB_SW_SHAMD5_H__
@@ -24,6 +24,8 @@
 
 #include <stdint.h>
 #include <stdbool.h>
+#include <stdio.h>
+#include <string.h>
 #include "inc/hw_memmap.h"
 #include "inc/hw_types.h"
 #include "driverlib/debug.h"
@@ -32,9 +34,19 @@
 #include "driverlib/pin_map.h"
 #include "driverlib/rom.h"
 #include "driverlib/rom_map.h"
+#include "driverlib/interrupt.h"
 #include "driverlib/sysctl.h"
 #include "driverlib/uart.h"
+#include "driverlib/sw_crc.h"
+#include "driverlib/sw_aes.h"
+#include "driverlib/sw_shamd5.h"
 #include "utils/uartstdio.h"
+#include "utils/ustdlib.h"
+#include "../utils/uart_dma.h"
+#include "../utils/uart_cfg.h"
+#include "../utils/fmt.h"
+#include "../utils/crc_stream.h"
+#include "../utils/gcm_stream.h"
 
 //*****************************************************************************
 //
@@ -46,8 +58,51 @@
 //!
 //! UART0, connected to the Virtual Serial Port and running at
 //! 115,200, 8-N-1, is used to display messages from this application.
+//! Output is queued in RAM and sent by uDMA, so printing does not block.
+//!
+//! At start-up every UART baud rate profile is run in internal loopback and
+//! the achieved baud error and throughput are printed, followed by the cycles
+//! taken to format one line with snprintf, usnprintf (the formatter behind
+//! UARTprintf) and FMT_PRINT, and the cycles per byte of Crc32(),
+//! Crc32Slice4() and Crc32Slice8() for several block sizes and alignments,
+//! and of Crc16Lanes() against one Crc16() per lane for 1 to 8 lanes.
+//! The crc_stream parameter sets are then checked against their catalogue
+//! check values, and CRC_update() is timed over the CRC buffer. Last come
+//! the cycles per byte of software AES-CTR, AES-GCM and SHA-256, and of a
+//! gcm_stream pass, whose tag is checked against the one-shot GCM.
+//!
+//! For code size, the post-build step runs text_sizes.py on the link map
+//! (Debug/hello_ccs.map) and prints the .text bytes of fmt.obj, ustdlib.obj
+//! and the run-time library's printf objects in the build console.
+//
+//*****************************************************************************
+
+//*****************************************************************************
+//
+// Bytes sent through the loopback per profile, and the results.
 //
 //*****************************************************************************
+#define SELFTEST_BYTES          4096
+uart_selftest_t g_psSelfTest[UART_PROFILE_COUNT];
+bool g_pbSelfTestPass[UART_PROFILE_COUNT];
+
+//*****************************************************************************
+//
+// Cortex-M4 cycle counter, for the formatter, CRC and crypto benchmarks.
+//
+//*****************************************************************************
+#define DEMCR                   0xE000EDFC
+#define DEMCR_TRCENA            0x01000000
+#define DWT_CTRL                0xE0001000
+#define DWT_CYCCNT              0xE0001004
+
+//*****************************************************************************
+//
+// The CRC benchmark buffer: the largest block plus room to misalign it.
+//
+//*****************************************************************************
+#define CRC_BENCH_MAX           4096
+uint8_t g_pui8CrcBuf[CRC_BENCH_MAX + 4];
 
 //*****************************************************************************
 //
@@ -63,7 +118,8 @@ __error__(char *pcFilename, uint32_t ui32Line)
 
 //*****************************************************************************
 //
-// Configure the UART and its pins.  This must be called before UARTprintf().
+// Configure the UART and its pins.  This must be called before
+// UART_tx_printf().
 //
 //*****************************************************************************
 void
@@ -87,14 +143,390 @@ ConfigureUART(void)
     MAP_GPIOPinTypeUART(GPIO_PORTA_BASE, GPIO_PIN_0 | GPIO_PIN_1);
 
     //
-    // Use the internal 16MHz oscillator as the UART clock source.
+    // Clock the UART from the system clock, 115,200 8-N-1 for the ICDI
+    // virtual serial port.
     //
-    UARTClockSourceSet(UART0_BASE, UART_CLOCK_PIOSC);
+    UART_configure(UART0_BASE, UART_PROFILE_115200, false);
 
     //
-    // Initialize the UART for console I/O.
+    // Hand the transmitter to uDMA.  Completions arrive by interrupt.
     //
-    UARTStdioConfig(0, 115200, 16000000);
+    UART_tx_init();
+    MAP_IntMasterEnable();
+}
+
+//*****************************************************************************
+//
+// Time one SR04-style line ("Distance: 12.35 cm") formatted four ways and
+// print the cycle counts.  The inputs are volatile so nothing is folded at
+// compile time.
+//
+//*****************************************************************************
+void
+FormatBenchmark(void)
+{
+    static const char * const ppcName[4] =
+    {
+        "snprintf %d    ", "snprintf %.2f  ", "usnprintf      ", "FMT_PRINT      "
+    };
+    volatile uint32_t ui32Um = 123456;
+    volatile float fCm = 12.3456f;
+    uint32_t pui32Cycles[4], ui32Start, ui32Idx;
+    char pcBuf[32];
+    fmt_buf_t sBuf;
+    fmt_sink_t *psSink;
+
+    HWREG(DEMCR) |= DEMCR_TRCENA;
+    HWREG(DWT_CTRL) |= 1;
+
+    ui32Start = HWREG(DWT_CYCCNT);
+    snprintf(pcBuf, sizeof(pcBuf), "Distance: %d.%02d cm\n",
+             ui32Um / 10000, (ui32Um / 100) % 100);
+    pui32Cycles[0] = HWREG(DWT_CYCCNT) - ui32Start;
+
+    ui32Start = HWREG(DWT_CYCCNT);
+    snprintf(pcBuf, sizeof(pcBuf), "Distance: %.2f cm\n", fCm);
+    pui32Cycles[1] = HWREG(DWT_CYCCNT) - ui32Start;
+
+    ui32Start = HWREG(DWT_CYCCNT);
+    usnprintf(pcBuf, sizeof(pcBuf), "Distance: %d.%02d cm\n",
+              ui32Um / 10000, (ui32Um / 100) % 100);
+    pui32Cycles[2] = HWREG(DWT_CYCCNT) - ui32Start;
+
+    ui32Start = HWREG(DWT_CYCCNT);
+    psSink = fmt_buf_init(&sBuf, pcBuf, sizeof(pcBuf));
+    FMT_PRINT(psSink, FMT_S("Distance: "), FMT_UFIX(ui32Um, 4, 2, 0),
+              FMT_S(" cm\n"));
+    pui32Cycles[3] = HWREG(DWT_CYCCNT) - ui32Start;
+
+    for(ui32Idx = 0; ui32Idx < 4; ui32Idx++)
+    {
+        FMT_PRINT(&uart_tx_sink, FMT_S(ppcName[ui32Idx]),
+                  FMT_U(pui32Cycles[ui32Idx], 6), FMT_S(" cycles\n"));
+    }
+}
+
+//*****************************************************************************
+//
+// Check each crc_stream parameter set against its check value for
+// "123456789", fed in two uneven pieces, then time CRC-32 over the whole CRC
+// buffer from a misaligned start and check it against CRC_compute().
+//
+//*****************************************************************************
+void
+CrcStreamCheck(void)
+{
+    static const crc_params_t * const ppsParams[6] =
+    {
+        &CRC_32, &CRC_32C, &CRC_16_ARC, &CRC_16_MODBUS, &CRC_16_CCITT_FALSE,
+        &CRC_8_SMBUS
+    };
+    static const char * const ppcName[6] =
+    {
+        "CRC-32", "CRC-32C", "CRC-16/ARC", "CRC-16/MODBUS",
+        "CRC-16/CCITT-FALSE", "CRC-8/SMBUS"
+    };
+    static const uint32_t pui32Check[6] =
+    {
+        0xCBF43926, 0xE3069283, 0xBB3D, 0x4B37, 0x29B1, 0xF4
+    };
+    crc_ctx_t sCrc;
+    uint32_t ui32Idx, ui32Crc, ui32Start, ui32Cycles;
+
+    FMT_PRINT(&uart_tx_sink, FMT_S("crc_stream check values\n"));
+    for(ui32Idx = 0; ui32Idx < 6; ui32Idx++)
+    {
+        CRC_init(&sCrc, ppsParams[ui32Idx]);
+        CRC_update(&sCrc, "1234", 4);
+        CRC_update(&sCrc, "56789", 5);
+        ui32Crc = CRC_final(&sCrc);
+        FMT_PRINT(&uart_tx_sink, FMT_S(ppcName[ui32Idx]), FMT_S(" "),
+                  FMT_X(ui32Crc, 0),
+                  FMT_S(ui32Crc == pui32Check[ui32Idx] ? " ok\n" :
+                        " MISMATCH\n"));
+    }
+
+    ui32Start = HWREG(DWT_CYCCNT);
+    CRC_init(&sCrc, &CRC_32);
+    CRC_update(&sCrc, g_pui8CrcBuf + 1, 1000);
+    CRC_update(&sCrc, g_pui8CrcBuf + 1001, CRC_BENCH_MAX - 1000);
+    ui32Crc = CRC_final(&sCrc);
+    ui32Cycles = HWREG(DWT_CYCCNT) - ui32Start;
+
+    FMT_PRINT(&uart_tx_sink, FMT_S("CRC_update CRC-32 cycles/byte x100: "),
+              FMT_U((ui32Cycles * 100) / CRC_BENCH_MAX, 0),
+              FMT_S(ui32Crc == CRC_compute(&CRC_32, g_pui8CrcBuf + 1,
+                                           CRC_BENCH_MAX) ? "\n" :
+                    "  MISMATCH\n"));
+    UART_tx_flush();
+}
+
+//*****************************************************************************
+//
+// Time the byte-wise and sliced CRC-32 over blocks of several sizes at each
+// byte alignment, check that all three agree, and print cycles per byte in
+// hundredths.  Flash wait states are included, as they would be in use.
+//
+//*****************************************************************************
+void
+CrcBenchmark(void)
+{
+    static const uint32_t pui32Size[3] = { 64, 1024, CRC_BENCH_MAX };
+    static uint32_t (* const ppfnCrc[3])(uint32_t, const uint8_t *,
+                                         uint32_t) =
+    {
+        Crc32, Crc32Slice4, Crc32Slice8
+    };
+    uint32_t pui32Crc[3], pui32Cycles[3], ui32Start, ui32Size, ui32Align;
+    uint32_t ui32Idx, ui32Lanes, ui32Bytes;
+    const uint8_t *ppui8Lane[8];
+    uint16_t pui16Lane[8], ui16Seq;
+    bool bMatch;
+
+    for(ui32Idx = 0; ui32Idx < sizeof(g_pui8CrcBuf); ui32Idx++)
+    {
+        g_pui8CrcBuf[ui32Idx] = (uint8_t)(ui32Idx * 131 + 7);
+    }
+
+    HWREG(DEMCR) |= DEMCR_TRCENA;
+    HWREG(DWT_CTRL) |= 1;
+
+    FMT_PRINT(&uart_tx_sink, FMT_S("CRC-32 cycles/byte x100, slices built: "),
+              FMT_U(SW_CRC32_SLICE, 0), FMT_S("\n"));
+    FMT_PRINT(&uart_tx_sink, FMT_S(" size al  Crc32  Slice4  Slice8\n"));
+
+    for(ui32Size = 0; ui32Size < 3; ui32Size++)
+    {
+        for(ui32Align = 0; ui32Align < 4; ui32Align++)
+        {
+            for(ui32Idx = 0; ui32Idx < 3; ui32Idx++)
+            {
+                ui32Start = HWREG(DWT_CYCCNT);
+                pui32Crc[ui32Idx] =
+                    ppfnCrc[ui32Idx](0xFFFFFFFF, g_pui8CrcBuf + ui32Align,
+                                     pui32Size[ui32Size]);
+                pui32Cycles[ui32Idx] = HWREG(DWT_CYCCNT) - ui32Start;
+            }
+
+            FMT_PRINT(&uart_tx_sink, FMT_U(pui32Size[ui32Size], 5),
+                      FMT_U(ui32Align, 3),
+                      FMT_U((pui32Cycles[0] * 100) / pui32Size[ui32Size], 7),
+                      FMT_U((pui32Cycles[1] * 100) / pui32Size[ui32Size], 8),
+                      FMT_U((pui32Cycles[2] * 100) / pui32Size[ui32Size], 8),
+                      FMT_S(((pui32Crc[1] == pui32Crc[0]) &&
+                             (pui32Crc[2] == pui32Crc[0])) ? "\n" :
+                            "  MISMATCH\n"));
+
+            //
+            // Let the transmit ring drain so the next row has room.
+            //
+            UART_tx_flush();
+        }
+    }
+
+    //
+    // CRC-16 over 1 to 8 lanes of CRC_BENCH_MAX / 8 bytes each, interleaved
+    // and one lane after another.
+    //
+    FMT_PRINT(&uart_tx_sink,
+              FMT_S("CRC-16 cycles/byte x100\nlanes  Lanes  Crc16\n"));
+    for(ui32Lanes = 1; ui32Lanes <= 8; ui32Lanes++)
+    {
+        ui32Bytes = ui32Lanes * (CRC_BENCH_MAX / 8);
+        for(ui32Idx = 0; ui32Idx < ui32Lanes; ui32Idx++)
+        {
+            ppui8Lane[ui32Idx] = g_pui8CrcBuf + ui32Idx * (CRC_BENCH_MAX / 8);
+            pui16Lane[ui32Idx] = 0;
+        }
+
+        ui32Start = HWREG(DWT_CYCCNT);
+        Crc16Lanes(ui32Lanes, pui16Lane, ppui8Lane, CRC_BENCH_MAX / 8);
+        pui32Cycles[0] = HWREG(DWT_CYCCNT) - ui32Start;
+
+        bMatch = true;
+        ui32Start = HWREG(DWT_CYCCNT);
+        for(ui32Idx = 0; ui32Idx < ui32Lanes; ui32Idx++)
+        {
+            ui16Seq = Crc16(0, ppui8Lane[ui32Idx], CRC_BENCH_MAX / 8);
+            bMatch = bMatch && (ui16Seq == pui16Lane[ui32Idx]);
+        }
+        pui32Cycles[1] = HWREG(DWT_CYCCNT) - ui32Start;
+
+        FMT_PRINT(&uart_tx_sink, FMT_U(ui32Lanes, 5),
+                  FMT_U((pui32Cycles[0] * 100) / ui32Bytes, 7),
+                  FMT_U((pui32Cycles[1] * 100) / ui32Bytes, 7),
+                  FMT_S(bMatch ? "\n" : "  MISMATCH\n"));
+        UART_tx_flush();
+    }
+
+    CrcStreamCheck();
+}
+
+//*****************************************************************************
+//
+// A gcm_stream sender that only counts, so the stream can be timed without
+// the UART.
+//
+//*****************************************************************************
+uint32_t g_ui32GcmSent;
+
+bool
+GcmCountSend(const void *pvBuf, uint32_t ui32Len)
+{
+    g_ui32GcmSent += ui32Len;
+    return true;
+}
+
+//*****************************************************************************
+//
+// Encrypt the CRC buffer through gcm_stream in uneven writes, then again in
+// place with SWAESDataProcessAuth() under the same key, IV and AAD, and check
+// that both give the same tag and that the stream sent the data and tag.
+//
+//*****************************************************************************
+void
+GcmStreamCheck(const uint32_t *pui32Key)
+{
+    static gcm_stream_t sStream;
+    static tSWAESContext sGCM;
+    uint32_t pui32IV[4], pui32AAD[4], pui32Tag[4], pui32StreamTag[4];
+    uint32_t ui32Start, ui32Cycles, ui32Idx;
+
+    for(ui32Idx = 0; ui32Idx < 4; ui32Idx++)
+    {
+        pui32IV[ui32Idx] = 0;
+        pui32AAD[ui32Idx] = 0x5A5A5A5A;
+    }
+
+    g_ui32GcmSent = 0;
+    ui32Start = HWREG(DWT_CYCCNT);
+    GCM_stream_begin(&sStream, pui32Key, 128, (const uint8_t *)pui32IV,
+                     pui32AAD, 16, GcmCountSend);
+    GCM_stream_write(&sStream, g_pui8CrcBuf, 1000);
+    GCM_stream_write(&sStream, g_pui8CrcBuf + 1000, 7);
+    GCM_stream_write(&sStream, g_pui8CrcBuf + 1007, CRC_BENCH_MAX - 1007);
+    GCM_stream_end(&sStream, (uint8_t *)pui32StreamTag);
+    ui32Cycles = HWREG(DWT_CYCCNT) - ui32Start;
+
+    SWAESConfigSet(&sGCM, AES_CFG_DIR_ENCRYPT | AES_CFG_MODE_GCM_HY0CALC);
+    SWAESKey1Set(&sGCM, pui32Key, AES_CFG_KEY_SIZE_128BIT);
+    SWAESIVSet(&sGCM, pui32IV);
+    SWAESDataProcessAuth(&sGCM, (const uint32_t *)g_pui8CrcBuf,
+                         (uint32_t *)g_pui8CrcBuf, CRC_BENCH_MAX, pui32AAD, 16,
+                         pui32Tag);
+
+    FMT_PRINT(&uart_tx_sink, FMT_S("gcm_stream cycles/byte x100: "),
+              FMT_U((ui32Cycles * 100) / CRC_BENCH_MAX, 0),
+              FMT_S(((memcmp(pui32Tag, pui32StreamTag, 16) == 0) &&
+                     (g_ui32GcmSent == CRC_BENCH_MAX + GCM_TAG_SIZE)) ?
+                    "\n" : "  MISMATCH\n"));
+    UART_tx_flush();
+}
+
+//*****************************************************************************
+//
+// Check the software AES and SHA-256 against one known answer each, then
+// time AES-128/256 in CTR mode, AES-128 GCM and SHA-256 over blocks of
+// several sizes, in cycles per byte x100.  The key schedule and GHASH tables
+// are set up once, outside the timing, as they would be for a telemetry
+// link.
+//
+//*****************************************************************************
+void
+CryptoBenchmark(void)
+{
+    static const uint32_t pui32Size[3] = { 64, 1024, CRC_BENCH_MAX };
+    static const uint8_t pui8Key[32] =
+    {
+        0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07,
+        0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f,
+        0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17,
+        0x18, 0x19, 0x1a, 0x1b, 0x1c, 0x1d, 0x1e, 0x1f
+    };
+    static const uint8_t pui8PT[16] =
+    {
+        0x00, 0x11, 0x22, 0x33, 0x44, 0x55, 0x66, 0x77,
+        0x88, 0x99, 0xaa, 0xbb, 0xcc, 0xdd, 0xee, 0xff
+    };
+    static const uint8_t pui8CT[16] =
+    {
+        0x69, 0xc4, 0xe0, 0xd8, 0x6a, 0x7b, 0x04, 0x30,
+        0xd8, 0xcd, 0xb7, 0x80, 0x70, 0xb4, 0xc5, 0x5a
+    };
+    static const uint8_t pui8SHA256abc[4] = { 0xba, 0x78, 0x16, 0xbf };
+    static tSWAESContext sCtr128, sCtr256, sGCM;
+    static tSWSHAMD5Context sSHA;
+    uint32_t pui32Block[4], pui32Digest[8], pui32Tag[4], pui32IV[4];
+    uint32_t pui32Cycles[4], ui32Start, ui32Size, ui32Idx;
+
+    //
+    // Known answers: FIPS-197 C.1 and the first word of SHA-256("abc").
+    //
+    SWAESConfigSet(&sCtr128, AES_CFG_DIR_ENCRYPT | AES_CFG_MODE_ECB);
+    SWAESKey1Set(&sCtr128, (const uint32_t *)pui8Key, AES_CFG_KEY_SIZE_128BIT);
+    SWAESBlockEncrypt(&sCtr128, pui8PT, (uint8_t *)pui32Block);
+    SWSHAMD5ConfigSet(&sSHA, SHAMD5_ALGO_SHA256);
+    SWSHAMD5DataProcess(&sSHA, (const uint32_t *)"abc", 3, pui32Digest);
+    FMT_PRINT(&uart_tx_sink, FMT_S("AES-128 KAT: "),
+              FMT_S(memcmp(pui32Block, pui8CT, 16) ? "FAIL" : "PASS"),
+              FMT_S(", SHA-256 KAT: "),
+              FMT_S(memcmp(pui32Digest, pui8SHA256abc, 4) ? "FAIL\n" :
+                    "PASS\n"));
+
+    for(ui32Idx = 0; ui32Idx < 4; ui32Idx++)
+    {
+        pui32IV[ui32Idx] = 0;
+    }
+    SWAESConfigSet(&sCtr128, AES_CFG_DIR_ENCRYPT | AES_CFG_MODE_CTR |
+                   AES_CFG_CTR_WIDTH_32);
+    SWAESKey1Set(&sCtr128, (const uint32_t *)pui8Key, AES_CFG_KEY_SIZE_128BIT);
+    SWAESIVSet(&sCtr128, pui32IV);
+    SWAESConfigSet(&sCtr256, AES_CFG_DIR_ENCRYPT | AES_CFG_MODE_CTR |
+                   AES_CFG_CTR_WIDTH_32);
+    SWAESKey1Set(&sCtr256, (const uint32_t *)pui8Key, AES_CFG_KEY_SIZE_256BIT);
+    SWAESIVSet(&sCtr256, pui32IV);
+    SWAESConfigSet(&sGCM, AES_CFG_DIR_ENCRYPT | AES_CFG_MODE_GCM_HY0CALC);
+    SWAESKey1Set(&sGCM, (const uint32_t *)pui8Key, AES_CFG_KEY_SIZE_128BIT);
+
+    HWREG(DEMCR) |= DEMCR_TRCENA;
+    HWREG(DWT_CTRL) |= 1;
+
+    FMT_PRINT(&uart_tx_sink, FMT_S("Crypto cycles/byte x100\n"
+                                   " size  CTR128  CTR256  GCM128  SHA256\n"));
+    for(ui32Size = 0; ui32Size < 3; ui32Size++)
+    {
+        ui32Start = HWREG(DWT_CYCCNT);
+        SWAESDataProcess(&sCtr128, (const uint32_t *)g_pui8CrcBuf,
+                         (uint32_t *)g_pui8CrcBuf, pui32Size[ui32Size]);
+        pui32Cycles[0] = HWREG(DWT_CYCCNT) - ui32Start;
+
+        ui32Start = HWREG(DWT_CYCCNT);
+        SWAESDataProcess(&sCtr256, (const uint32_t *)g_pui8CrcBuf,
+                         (uint32_t *)g_pui8CrcBuf, pui32Size[ui32Size]);
+        pui32Cycles[1] = HWREG(DWT_CYCCNT) - ui32Start;
+
+        ui32Start = HWREG(DWT_CYCCNT);
+        SWAESIVSet(&sGCM, pui32IV);
+        SWAESDataProcessAuth(&sGCM, (const uint32_t *)g_pui8CrcBuf,
+                             (uint32_t *)g_pui8CrcBuf, pui32Size[ui32Size],
+                             pui32IV, 16, pui32Tag);
+        pui32Cycles[2] = HWREG(DWT_CYCCNT) - ui32Start;
+
+        ui32Start = HWREG(DWT_CYCCNT);
+        SWSHAMD5DataProcess(&sSHA, (const uint32_t *)g_pui8CrcBuf,
+                            pui32Size[ui32Size], pui32Digest);
+        pui32Cycles[3] = HWREG(DWT_CYCCNT) - ui32Start;
+
+        FMT_PRINT(&uart_tx_sink, FMT_U(pui32Size[ui32Size], 5),
+                  FMT_U((pui32Cycles[0] * 100) / pui32Size[ui32Size], 8),
+                  FMT_U((pui32Cycles[1] * 100) / pui32Size[ui32Size], 8),
+                  FMT_U((pui32Cycles[2] * 100) / pui32Size[ui32Size], 8),
+                  FMT_U((pui32Cycles[3] * 100) / pui32Size[ui32Size], 8),
+                  FMT_S("\n"));
+        UART_tx_flush();
+    }
+
+    GcmStreamCheck((const uint32_t *)pui8Key);
 }
 
 //*****************************************************************************
@@ -106,6 +538,7 @@ int
 main(void)
 {
     //volatile uint32_t ui32Loop;
+    uint32_t ui32Profile;
 
     //
     // Enable lazy stacking for interrupt handlers.  This allows floating-point
@@ -130,6 +563,18 @@ main(void)
     //
     MAP_GPIOPinTypeGPIOOutput(GPIO_PORTF_BASE, GPIO_PIN_2);
 
+    //
+    // Run every profile in loopback while the pins are still GPIO, so
+    // nothing reaches the virtual serial port.
+    //
+    MAP_SysCtlPeripheralEnable(SYSCTL_PERIPH_UART0);
+    for(ui32Profile = 0; ui32Profile < UART_PROFILE_COUNT; ui32Profile++)
+    {
+        g_pbSelfTestPass[ui32Profile] =
+            UART_self_test(UART0_BASE, (uart_profile_t)ui32Profile,
+                           SELFTEST_BYTES, &g_psSelfTest[ui32Profile]);
+    }
+
     //
     // Initialize the UART.
     //
@@ -138,7 +583,37 @@ main(void)
     //
     // Hello!
     //
-    UARTprintf("Hello, world!\n");
+    UART_tx_printf("Hello, world!\n");
+
+    //
+    // Report the loopback results.
+    //
+    for(ui32Profile = 0; ui32Profile < UART_PROFILE_COUNT; ui32Profile++)
+    {
+        uart_selftest_t *psTest = &g_psSelfTest[ui32Profile];
+
+        UART_tx_printf("%7u baud: %7u actual (%d ppm), %u B/s (%u.%u%%), "
+                       "%u errors, %s\n", psTest->baud, psTest->actual_baud,
+                       psTest->error_ppm, psTest->bytes_per_s,
+                       psTest->efficiency_pm / 10, psTest->efficiency_pm % 10,
+                       psTest->errors,
+                       g_pbSelfTestPass[ui32Profile] ? "PASS" : "FAIL");
+    }
+
+    //
+    // Compare the formatters.
+    //
+    FormatBenchmark();
+
+    //
+    // Compare the CRC-32 variants.
+    //
+    CrcBenchmark();
+
+    //
+    // Time the software AES and SHA-256.
+    //
+    CryptoBenchmark();
 
     //
     // We are finished.  Hang around doing nothing.
@@ -0,0 +1,75 @@
+#!/usr/bin/env python3
+#
+# text_sizes.py - code size of the three formatters in a TI linker map.
+#
+# Sums the .text input sections of each object file in a map written by the
+# TI ARM linker (e.g. Debug/hello.map) and prints the ones hello.c compares:
+# fmt.obj (FMT_PRINT), ustdlib.obj (usnprintf/UARTprintf) and the run-time
+# library's printf objects (_printfi and the conversion helpers it pulls
+# in). Runs as hello's post-build step; --all lists every object.
+#
+# Usage: text_sizes.py [--all] <file.map>
+#
+# Author   : Jithin B.P.
+# Affiliation: CSpark Research
+# Email    : jithinuser@gmail.com
+#
+# License  : This source code is released under an open-source license.
+#            You may use, modify, and distribute it freely, provided that
+#            proper attribution is given to the original author.
+#
+# Created  : 2025
+
+import argparse
+import re
+import sys
+
+# "  00001234    000001f8     fmt.obj (.text:fmt_print)"
+# "  00002000    00001136     rtsv7M4_T_le_v4SPD16_eabi.lib : _printfi.c.obj (.text:__TI_printfi)"
+SECTION = re.compile(r'^\s*[0-9a-fA-F]{8}\s+([0-9a-fA-F]{8})\s+'
+                     r'(?:\S+\s*:\s*)?(\S+)\s+\((\.text[^)]*)\)')
+
+GROUPS = [
+    ('fmt', re.compile(r'^fmt\.obj$')),
+    ('ustdlib', re.compile(r'^ustdlib\.obj$')),
+    ('printf', re.compile(r'printf|_ltoa|ecvt|fcvt|frexp|ldexp')),
+]
+
+
+def text_sizes(path):
+    sizes = {}
+    with open(path, errors='replace') as f:
+        for line in f:
+            m = SECTION.match(line)
+            if m:
+                obj = m.group(2)
+                sizes[obj] = sizes.get(obj, 0) + int(m.group(1), 16)
+    return sizes
+
+
+def main():
+    ap = argparse.ArgumentParser()
+    ap.add_argument('--all', action='store_true', help='list every object')
+    ap.add_argument('map')
+    args = ap.parse_args()
+
+    sizes = text_sizes(args.map)
+    if not sizes:
+        sys.exit('%s: no .text sections found' % args.map)
+
+    if args.all:
+        for obj in sorted(sizes, key=sizes.get, reverse=True):
+            print('%7d  %s' % (sizes[obj], obj))
+        return
+
+    print('.text bytes')
+    for name, pattern in GROUPS:
+        objs = sorted(o for o in sizes if pattern.search(o))
+        total = sum(sizes[o] for o in objs)
+        print('%7d  %s%s' % (total, name,
+                             (' (' + ', '.join(objs) + ')') if objs else
+                             ' (not linked)'))
+
+
+if __name__ == '__main__':
+    main()
@@ -7,6 +7,31 @@
  *   on the TI Tiva C (TM4C123) microcontroller, and displaying the results
  *   over UART 8N1
  *
+ *   The echo pulse is timed in hardware: PB3 is the T3CCP1 input of Timer3B,
+ *   running in edge-time capture mode on both edges. The interrupt stores the
+ *   two edge timestamps and computes the pulse width, so its accuracy does
+ *   not depend on how fast the CPU polls the pin.
+ *
+ *   A ping is started with SR04Start() and finished by interrupts; the
+ *   result is collected with SR04Poll() or delivered to a callback. Timer3A
+ *   runs as a one-shot watchdog for every ping, so an unplugged sensor ends
+ *   in SR04_NO_ECHO instead of hanging the program.
+ *
+ *   Distances are computed in fixed point and returned in micrometres. The
+ *   speed of sound follows the air temperature set with SR04SetTemperature()
+ *   (e.g. from a BMP180), so no float math runs per ping.
+ *
+ *   Readings are cleaned up by the filter in sr04_filter.c (sliding median,
+ *   spike gate, alpha-beta tracker) before they are printed.
+ *
+ *   Commands are read from the same UART. A frame ends when the line goes
+ *   idle, so send each command in one go (e.g. from a script, not typed):
+ *     t <temp>   air temperature in 0.1 deg C, e.g. "t 215" for 21.5 C
+ *                (-200..400, clamped)
+ *     f <width>  median filter width (1..15), restarts the filter
+ *   Both settings are kept in the EEPROM by kv_store.c and restored at
+ *   start-up.
+ *
  * Author   : Jithin B.P.
  * Affiliation: CSpark Research
  * Email    : jithinuser@gmail.com
@@ -23,23 +48,85 @@
 #include "inc/hw_types.h"
 #include "inc/hw_gpio.h"
 #include "inc/hw_timer.h"
+#include "inc/hw_ints.h"
 #include "driverlib/sysctl.h"
 #include "driverlib/gpio.h"
 #include "driverlib/timer.h"
+#include "driverlib/interrupt.h"
 #include "driverlib/uart.h"
 #include "utils/uartstdio.h"
+#include "../utils/uart_dma.h"
+#include "../utils/uart_cfg.h"
+#include "../utils/kv_store.h"
 #include "driverlib/pin_map.h"
+#include "sr04_filter.h"
 
 #define TRIG_PORT   GPIO_PORTB_BASE
 #define TRIG_PIN    GPIO_PIN_2        // PB2 as Trigger
 #define ECHO_PORT   GPIO_PORTB_BASE
-#define ECHO_PIN    GPIO_PIN_3        // PB3 as Echo
+#define ECHO_PIN    GPIO_PIN_3        // PB3 as Echo (T3CCP1)
+
+// Echo capture timer: Timer3B, 16 bits + 8-bit prescaler = 24-bit timestamps
+// Ping timeout timer: Timer3A one-shot, prescaled by 256
+#define ECHO_TIMER      TIMER3_BASE
+#define ECHO_TIMER_INT  INT_TIMER3B
+#define PING_TIMER_INT  INT_TIMER3A
+#define ECHO_TS_MASK    0x00FFFFFF
+
+// The HC-SR04 holds echo high ~38 ms when nothing is in range, and its
+// rated range of 400 cm is a 23.3 ms round trip
+#define PING_TIMEOUT_US 30000
+#define MAX_ECHO_US     23300
+
+// Speed of sound in dry air, 331.3 * sqrt(1 + T / 273.15) m/s (T in deg C),
+// as the straight line c = 331.1 + 0.597 * T. That line is the best fit over
+// -20 to +40 C and is within 0.072% of the square root there; the tangent at
+// 0 C (331.3 + 0.606 * T) would be 0.23% fast at 40 C. Outside that range
+// the temperature is clamped. Temperatures are in 0.1 deg C, the BMP180's
+// unit.
+#define SOUND_SPEED_0C_MM_S     331100
+#define SOUND_SPEED_MM_S_PER_C  597
+#define AIR_TEMP_MIN_DC         (-200)
+#define AIR_TEMP_MAX_DC         400
+#define AIR_TEMP_DEFAULT_DC     200     // 20.0 C until a reading is set
 
-// Speed of sound: 343 m/s = 0.0343 cm/us
-#define SOUND_SPEED_CM_PER_US 0.0343
+// Range filter: 5-sample median, spikes over 10 cm from the track dropped,
+// 3 in a row taken as a real jump
+#define FILTER_MEDIAN_WIDTH     5
+#define FILTER_ALPHA_Q8         128     // 0.5
+#define FILTER_BETA_Q8          26      // 0.1
+#define FILTER_GATE_UM          100000
+#define FILTER_REACQUIRE        3
+
+// kv_store keys of the settings kept across resets
+#define KEY_AIR_TEMP_DC         0
+#define KEY_MEDIAN_WIDTH        1
 
 void ADCSeq0Handler(){}
 
+// Result of a ping
+typedef enum {
+    SR04_IDLE,          // No ping started
+    SR04_BUSY,          // Ping in flight
+    SR04_OK,            // Echo received, distance valid
+    SR04_NO_ECHO,       // No echo started before the timeout (sensor missing?)
+    SR04_OUT_OF_RANGE   // Echo longer than the rated range, or never ended
+} sr04_status_t;
+
+// Called from interrupt context when a ping completes
+typedef void (*sr04_callback_t)(sr04_status_t status, uint32_t ticks);
+
+// Echo capture state, shared with the Timer3 interrupt handlers
+volatile sr04_status_t sr04Status = SR04_IDLE;
+volatile uint32_t echoRise;             // Timestamp of the rising edge
+volatile uint32_t echoTicks;            // Pulse width in system clock ticks
+volatile bool echoGotRise = false;
+sr04_callback_t sr04Callback;
+uint32_t sysClockHz;
+uint32_t maxEchoTicks;
+uint32_t umPerTickQ16;                  // One-way distance per echo tick, Q16 um
+sr04_filter_t rangeFilter;
+
 // UART configuration
 void ConfigureUART(void)
 {
@@ -50,82 +137,287 @@ void ConfigureUART(void)
     GPIOPinConfigure(GPIO_PA1_U0TX);
     GPIOPinTypeUART(GPIO_PORTA_BASE, GPIO_PIN_0 | GPIO_PIN_1);
 
-    UARTClockSourceSet(UART0_BASE, UART_CLOCK_PIOSC);
-    UARTStdioConfig(0, 115200, 16000000);
+    // 115200 8N1 from the system clock; the faster profiles need a
+    // USB-UART adapter instead of the ICDI virtual COM port
+    UART_configure(UART0_BASE, UART_PROFILE_115200, false);
+
+    // Buffered output: FMT_PRINT(&uart_tx_sink, ...) queues, uDMA drains.
+    // Input arrives by uDMA too, framed by line idle.
+    UART_tx_init();
+    UART_rx_init();
+    IntMasterEnable();
+}
+
+// Sets the air temperature (0.1 deg C) used for the speed of sound, clamped
+// to the range of the fit, and returns the value used. Cheap enough to call
+// before every ping; the conversion itself stays a multiply.
+int32_t SR04SetTemperature(int32_t tempDC)
+{
+    uint32_t c_mm_s;
+
+    if (tempDC < AIR_TEMP_MIN_DC) tempDC = AIR_TEMP_MIN_DC;
+    if (tempDC > AIR_TEMP_MAX_DC) tempDC = AIR_TEMP_MAX_DC;
+    c_mm_s = SOUND_SPEED_0C_MM_S + (SOUND_SPEED_MM_S_PER_C * tempDC) / 10;
+
+    // um per tick = c[mm/s] * 1000 / (2 * f), halved for the round trip
+    umPerTickQ16 = (uint32_t)(((uint64_t)c_mm_s * 1000 << 16) / (2 * sysClockHz));
+    return tempDC;
 }
 
 // Initialize GPIO and Timer
 void SR04Init(void)
 {
+    sysClockHz = SysCtlClockGet();
+    maxEchoTicks = (sysClockHz / 1000000) * MAX_ECHO_US;
+    SR04SetTemperature(AIR_TEMP_DEFAULT_DC);
+
     // Enable GPIOB
     SysCtlPeripheralEnable(SYSCTL_PERIPH_GPIOB);
 
     // Trigger pin as output
     GPIOPinTypeGPIOOutput(TRIG_PORT, TRIG_PIN);
+    GPIOPinWrite(TRIG_PORT, TRIG_PIN, 0);
 
-    // Echo pin as input
-    GPIOPinTypeGPIOInput(ECHO_PORT, ECHO_PIN);
+    // Echo pin as capture input for Timer3B
+    GPIOPinConfigure(GPIO_PB3_T3CCP1);
+    GPIOPinTypeTimer(ECHO_PORT, ECHO_PIN);
 
-    // Timer0 as free-running 16-bit up-counter (to measure echo pulse width)
-    SysCtlPeripheralEnable(SYSCTL_PERIPH_TIMER0);
-    TimerConfigure(TIMER0_BASE, TIMER_CFG_ONE_SHOT_UP);
+    // Timer3B: free-running down-counter that latches its value on both edges.
+    // In edge-time mode the prescaler extends the count to 24 bits
+    // (419 ms at 40 MHz), far longer than the longest echo.
+    // Timer3A: one-shot ping timeout, armed by SR04Start().
+    SysCtlPeripheralEnable(SYSCTL_PERIPH_TIMER3);
+    while(!SysCtlPeripheralReady(SYSCTL_PERIPH_TIMER3));
+    TimerConfigure(ECHO_TIMER, TIMER_CFG_SPLIT_PAIR | TIMER_CFG_A_ONE_SHOT |
+                               TIMER_CFG_B_CAP_TIME);
+    TimerControlEvent(ECHO_TIMER, TIMER_B, TIMER_EVENT_BOTH_EDGES);
+    TimerPrescaleSet(ECHO_TIMER, TIMER_B, 0xFF);
+    TimerLoadSet(ECHO_TIMER, TIMER_B, 0xFFFF);
+    TimerPrescaleSet(ECHO_TIMER, TIMER_A, 0xFF);
+
+    TimerIntEnable(ECHO_TIMER, TIMER_CAPB_EVENT | TIMER_TIMA_TIMEOUT);
+    IntEnable(ECHO_TIMER_INT);
+    IntEnable(PING_TIMER_INT);
+    IntMasterEnable();
+    TimerEnable(ECHO_TIMER, TIMER_B);
 }
 
-uint32_t SR04GetDistanceCM(void)
+// Ends the ping in flight. Called from both handlers; whichever comes first wins.
+static void SR04Finish(sr04_status_t status, uint32_t ticks)
 {
-    uint32_t startTime, endTime, pulseWidth;
-    float distance;
+    TimerDisable(ECHO_TIMER, TIMER_A);
+    echoGotRise = false;
+    echoTicks = ticks;
+    sr04Status = status;
+    if (sr04Callback) sr04Callback(status, ticks);
+}
+
+// Capture interrupt: first edge after a trigger is the rising edge, the next
+// one is the falling edge. The timer counts down, so width = rise - fall.
+void Timer3BIntHandler(void)
+{
+    uint32_t t, ticks;
+
+    TimerIntClear(ECHO_TIMER, TIMER_CAPB_EVENT);
+    t = TimerValueGet(ECHO_TIMER, TIMER_B) & ECHO_TS_MASK;
+    if (sr04Status != SR04_BUSY) return;
+
+    if (GPIOPinRead(ECHO_PORT, ECHO_PIN) != 0) {
+        echoRise = t;
+        echoGotRise = true;
+    } else if (echoGotRise) {
+        ticks = (echoRise - t) & ECHO_TS_MASK;
+        SR04Finish(ticks > maxEchoTicks ? SR04_OUT_OF_RANGE : SR04_OK, ticks);
+    }
+}
+
+// Timeout interrupt: the echo never started, or never ended
+void Timer3AIntHandler(void)
+{
+    TimerIntClear(ECHO_TIMER, TIMER_TIMA_TIMEOUT);
+    if (sr04Status != SR04_BUSY) return;
+
+    SR04Finish(echoGotRise ? SR04_OUT_OF_RANGE : SR04_NO_ECHO, 0);
+}
+
+// Starts a ping and returns at once (~10 us for the trigger pulse). The
+// result arrives by interrupt; fetch it with SR04Poll(), or pass a callback.
+// Returns false if a ping is in flight or the last echo has not ended yet.
+bool SR04Start(sr04_callback_t callback)
+{
+    if (sr04Status == SR04_BUSY) return false;
+    if (GPIOPinRead(ECHO_PORT, ECHO_PIN) != 0) return false;
+
+    sr04Callback = callback;
+    echoGotRise = false;
+    sr04Status = SR04_BUSY;
+
+    // Arm the timeout: (load + 1) * 256 ticks
+    TimerLoadSet(ECHO_TIMER, TIMER_A,
+                 ((sysClockHz / 1000000) * PING_TIMEOUT_US) / 256);
+    TimerEnable(ECHO_TIMER, TIMER_A);
 
-    // Trigger pulse
-    GPIOPinWrite(TRIG_PORT, TRIG_PIN, 0);
-    SysCtlDelay(SysCtlClockGet() / 300000); // ~3us
     GPIOPinWrite(TRIG_PORT, TRIG_PIN, TRIG_PIN);
-    SysCtlDelay(SysCtlClockGet() / 100000); // ~10us
+    SysCtlDelay(sysClockHz / 300000); // ~10us
     GPIOPinWrite(TRIG_PORT, TRIG_PIN, 0);
+    return true;
+}
 
-    // Wait for echo HIGH
-    while(GPIOPinRead(ECHO_PORT, ECHO_PIN) == 0);
+// Returns the state of the last ping; *ticks gets the echo width once done
+sr04_status_t SR04Poll(uint32_t *ticks)
+{
+    sr04_status_t status = sr04Status;
+
+    if (ticks && status != SR04_BUSY) *ticks = echoTicks;
+    return status;
+}
+
+// Converts an echo pulse width (system clock ticks) to micrometres: one
+// 32x32->64 multiply (UMULL) and a shift. 4 m fits easily in 32 bits.
+uint32_t SR04TicksToUM(uint32_t ticks)
+{
+    return (uint32_t)(((uint64_t)ticks * umPerTickQ16 + 0x8000) >> 16);
+}
+
+// Blocking helper: one ping, bounded by PING_TIMEOUT_US. Returns 0 on error.
+uint32_t SR04GetDistanceUM(void)
+{
+    uint32_t ticks;
+    sr04_status_t status;
 
-    // Setup timer
-    TimerConfigure(TIMER0_BASE, TIMER_CFG_ONE_SHOT);
-    TimerLoadSet(TIMER0_BASE, TIMER_A, 0xFFFFFFFF);
-    TimerEnable(TIMER0_BASE, TIMER_A);
+    if (!SR04Start(0)) return 0;
+    while((status = SR04Poll(&ticks)) == SR04_BUSY);
 
-    startTime = TimerValueGet(TIMER0_BASE, TIMER_A);
+    return (status == SR04_OK) ? SR04TicksToUM(ticks) : 0;
+}
 
-    // Wait for echo LOW
-    while(GPIOPinRead(ECHO_PORT, ECHO_PIN) != 0);
+// Runs one command frame. Parsed straight out of the receive ring.
+void SR04Command(const uart_frame_t *frame)
+{
+    uint16_t i = 1, n = frame->len + frame->len2;
+    int32_t value = 0, sign = 1;
+    int16_t saved;              // Settings are 2 bytes: one EEPROM word each
+    uint8_t c;
 
-    endTime = TimerValueGet(TIMER0_BASE, TIMER_A);
-    TimerDisable(TIMER0_BASE, TIMER_A);
+    if (n == 0) return;
 
-    // Timer counts down → pulse width = start - end
-    pulseWidth = startTime - endTime;
+    while (i < n && UART_frame_byte(frame, i) == ' ') i++;
+    if (i < n && UART_frame_byte(frame, i) == '-') {
+        sign = -1;
+        i++;
+    }
+    while (i < n && (c = UART_frame_byte(frame, i)) >= '0' && c <= '9') {
+        value = value * 10 + (c - '0');
+        i++;
+    }
+    value *= sign;
 
-    // Convert to µs
-    float time_us = (float)pulseWidth / (SysCtlClockGet() / 1000000.0);
+    switch (UART_frame_byte(frame, 0)) {
+    case 't':
+        value = SR04SetTemperature(value);
+        saved = (int16_t)value;
+        KV_set(KEY_AIR_TEMP_DC, &saved, sizeof(saved));
+        FMT_PRINT(&uart_tx_sink, FMT_S("Air temperature "),
+                  FMT_FIX(value, 1, 1, 0), FMT_S(" C\n"));
+        break;
+    case 'f':
+        // Clamped here, before the narrowing to uint8_t
+        if (value < 1) value = 1;
+        if (value > SR04_MEDIAN_MAX) value = SR04_MEDIAN_MAX;
+        SR04FilterInit(&rangeFilter, (uint8_t)value, FILTER_ALPHA_Q8, FILTER_BETA_Q8,
+                       FILTER_GATE_UM, FILTER_REACQUIRE);
+        saved = rangeFilter.width;
+        KV_set(KEY_MEDIAN_WIDTH, &saved, sizeof(saved));
+        FMT_PRINT(&uart_tx_sink, FMT_S("Median width "),
+                  FMT_U(rangeFilter.width, 0), FMT_S("\n"));
+        break;
+    default:
+        FMT_PRINT(&uart_tx_sink, FMT_S("Commands: t <0.1 C>, f <width>\n"));
+        break;
+    }
+}
 
-    // Distance in cm
-    distance = (time_us * SOUND_SPEED_CM_PER_US) / 2.0;
+// Work that goes on while a ping is in flight: command frames and the
+// settings log's background compaction. Output goes out by uDMA.
+static void SR04Service(void)
+{
+    uart_frame_t frame;
 
-    return (uint32_t)distance;
+    while (UART_rx_frame_get(&frame)) {
+        SR04Command(&frame);
+        UART_rx_frame_release(&frame);
+    }
+    KV_service();
 }
 
 int main(void)
 {
+    int16_t saved;
+    uint8_t width;
+
     // Run system clock at 40 MHz from PLL (16 MHz crystal / 400 MHz PLL / div10)
     SysCtlClockSet(SYSCTL_SYSDIV_5 | SYSCTL_USE_PLL |
                    SYSCTL_OSC_MAIN | SYSCTL_XTAL_16MHZ);
 
     ConfigureUART();
-    UARTprintf("SR04 Ultrasonic Sensor Demo\n");
+    FMT_PRINT(&uart_tx_sink, FMT_S("SR04 Ultrasonic Sensor Demo\n"));
+    FMT_PRINT(&uart_tx_sink, FMT_S("UART RX frames (3/4/8/12/13 bytes, loopback): "),
+              FMT_U(5 - UART_rx_frame_test(), 0), FMT_S("/5 ok\n"));
 
     SR04Init();
 
+    // Saved settings, or the defaults on a blank EEPROM
+    width = FILTER_MEDIAN_WIDTH;
+    if (KV_init()) {
+        if (KV_get(KEY_AIR_TEMP_DC, &saved, sizeof(saved)) == sizeof(saved))
+            SR04SetTemperature(saved);
+        if (KV_get(KEY_MEDIAN_WIDTH, &saved, sizeof(saved)) == sizeof(saved))
+            width = (uint8_t)saved;
+    }
+    SR04FilterInit(&rangeFilter, width, FILTER_ALPHA_Q8,
+                   FILTER_BETA_Q8, FILTER_GATE_UM, FILTER_REACQUIRE);
+
     while(1)
     {
-        uint32_t distance = SR04GetDistanceCM();
-        UARTprintf("Distance: %d cm\n", distance);
+        uint32_t ticks, um, filtered;
+        sr04_status_t status;
+
+        SR04Service();
+
+        // Refused while the previous echo is still high
+        if (!SR04Start(0)) {
+            SysCtlDelay(SysCtlClockGet() / 300);  // ~10ms
+            continue;
+        }
+
+        // The echo is timed in hardware; keep serving commands until then
+        while((status = SR04Poll(&ticks)) == SR04_BUSY)
+            SR04Service();
+
+        switch (status) {
+        case SR04_OK:
+            um = SR04TicksToUM(ticks);
+            // Micrometres shown as centimetres with two decimals
+            if (SR04FilterUpdate(&rangeFilter, um, &filtered))
+                FMT_PRINT(&uart_tx_sink, FMT_S("Distance: "),
+                          FMT_UFIX(filtered, 4, 2, 0), FMT_S(" cm (raw "),
+                          FMT_UFIX(um, 4, 2, 0), FMT_S(")\n"));
+            else
+                FMT_PRINT(&uart_tx_sink, FMT_S("Distance: "),
+                          FMT_UFIX(filtered, 4, 2, 0), FMT_S(" cm (spike "),
+                          FMT_UFIX(um, 4, 2, 0), FMT_S(" dropped)\n"));
+            break;
+        case SR04_NO_ECHO:
+            SR04FilterMiss(&rangeFilter);
+            FMT_PRINT(&uart_tx_sink, FMT_S("No echo (sensor connected?)\n"));
+            break;
+        case SR04_OUT_OF_RANGE:
+            SR04FilterMiss(&rangeFilter);
+            FMT_PRINT(&uart_tx_sink, FMT_S("Out of range\n"));
+            break;
+        default:
+            break;
+        }
 
         SysCtlDelay(SysCtlClockGet() / 60);  // ~50ms delay at 40MHz
     }
@@ -0,0 +1,137 @@
+/******************************************************************************
+ * Project  : Ultrasonic Distance Measurement (HC-SR04 + UART)
+ * File     : sr04_filter.c
+ *
+ * Description:
+ * Sliding median, spike gate and alpha-beta tracker for HC-SR04 ranges.
+ * See sr04_filter.h.
+ *
+ * Author   : Jithin B.P.
+ * Affiliation: CSpark Research
+ * Email    : jithinuser@gmail.com
+ *
+ * License  : This source code is released under an open-source license.
+ * You may use, modify, and distribute it freely, provided that
+ * proper attribution is given to the original author.
+ *
+ * Created  : 2025
+ ******************************************************************************/
+
+#include "sr04_filter.h"
+
+// Sets up a filter. width is the median window (odd, 1..SR04_MEDIAN_MAX;
+// 1 turns the median off). A reading further than gate_um from the
+// prediction is dropped, unless reacquire readings in a row were, in which
+// case the target really moved and the tracker restarts on the median.
+void SR04FilterInit(sr04_filter_t *f, uint8_t width, uint16_t alpha,
+                    uint16_t beta, uint32_t gate_um, uint8_t reacquire)
+{
+    if (width < 1) width = 1;
+    if (width > SR04_MEDIAN_MAX) width = SR04_MEDIAN_MAX;
+    f->width = width | 1;
+
+    f->alpha = alpha;
+    f->beta = beta;
+    f->gate_um = gate_um;
+    f->reacquire = reacquire;
+    f->rejects = 0;
+    f->primed = false;
+}
+
+// Replaces the oldest sample with z and returns the median. The sorted
+// window is rebuilt by one merge pass into the other buffer, skipping the
+// outgoing sample and placing the new one: always width + 1 steps, with no
+// search and no data-dependent exit.
+static int32_t SR04FilterMedian(sr04_filter_t *f, int32_t z)
+{
+    const int32_t *src = f->sorted[f->cur];
+    int32_t *dst = f->sorted[f->cur ^ 1];
+    int32_t old = f->ring[f->head];
+    bool removed = false, inserted = false;
+    uint8_t i, j = 0;
+
+    f->ring[f->head] = z;
+    if (++f->head == f->width) f->head = 0;
+
+    for (i = 0; i < f->width; i++) {
+        int32_t s = src[i];
+
+        if (!removed && s == old) {
+            removed = true;
+            continue;
+        }
+        if (!inserted && z < s) {
+            dst[j++] = z;
+            inserted = true;
+        }
+        dst[j++] = s;
+    }
+    if (!inserted) dst[j] = z;
+
+    f->cur ^= 1;
+    return dst[f->width / 2];
+}
+
+// Starts the median and tracker at z, on the first reading
+static void SR04FilterReset(sr04_filter_t *f, int32_t z)
+{
+    uint8_t i;
+
+    for (i = 0; i < f->width; i++) {
+        f->ring[i] = z;
+        f->sorted[f->cur][i] = z;
+    }
+    f->head = 0;
+    f->x = z;
+    f->v = 0;
+    f->rejects = 0;
+    f->primed = true;
+}
+
+// Feeds one good reading. *out_um gets the filtered distance. Returns false
+// if the reading was gated out as a spike (the estimate then coasts).
+bool SR04FilterUpdate(sr04_filter_t *f, uint32_t um, uint32_t *out_um)
+{
+    int32_t z, pred, r;
+
+    if (!f->primed) {
+        SR04FilterReset(f, (int32_t)um);
+        *out_um = um;
+        return true;
+    }
+
+    z = SR04FilterMedian(f, (int32_t)um);
+    pred = f->x + f->v;
+    r = z - pred;
+
+    if ((uint32_t)(r < 0 ? -r : r) > f->gate_um) {
+        // The median has settled somewhere new: restart the tracker on it.
+        // The window already holds the readings that moved it, so it is
+        // kept and the sample still costs one merge pass.
+        if (++f->rejects >= f->reacquire) {
+            f->x = z;
+            f->v = 0;
+            f->rejects = 0;
+            *out_um = z < 0 ? 0 : (uint32_t)z;
+            return true;
+        }
+        f->x = pred;
+        *out_um = pred < 0 ? 0 : (uint32_t)pred;
+        return false;
+    }
+
+    f->rejects = 0;
+    f->x = pred + ((f->alpha * r) >> 8);
+    f->v += (f->beta * r) >> 8;
+    *out_um = f->x < 0 ? 0 : (uint32_t)f->x;
+    return true;
+}
+
+// No echo this time: coast on the prediction and return it
+uint32_t SR04FilterMiss(sr04_filter_t *f)
+{
+    if (!f->primed) return 0;
+
+    f->x += f->v;
+    return f->x < 0 ? 0 : (uint32_t)f->x;
+}
@@ -0,0 +1,64 @@
+/******************************************************************************
+ * Project  : Ultrasonic Distance Measurement (HC-SR04 + UART)
+ * File     : sr04_filter.h
+ *
+ * Description:
+ * Per-sensor filtering of HC-SR04 ranges. Each raw reading goes through
+ * a sliding median, then a spike gate around the tracker's prediction,
+ * then an alpha-beta tracker. Integer math only; the cost per sample is
+ * fixed for a given median width, whatever the data. Only the first
+ * reading, which fills the window, costs one extra pass.
+ *
+ * Author   : Jithin B.P.
+ * Affiliation: CSpark Research
+ * Email    : jithinuser@gmail.com
+ *
+ * License  : This source code is released under an open-source license.
+ * You may use, modify, and distribute it freely, provided that
+ * proper attribution is given to the original author.
+ *
+ * Created  : 2025
+ ******************************************************************************/
+
+#ifndef SR04_FILTER_H
+#define SR04_FILTER_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#define SR04_MEDIAN_MAX     15          // Widest median window (odd)
+
+// Filter state for one sensor. All distances in micrometres.
+//
+// The alpha-beta gains are Q8 (256 = 1.0). A steady-state Kalman filter for
+// a constant-velocity target is an alpha-beta filter, so gains taken from
+// the Kalman tracking index give the Kalman tracker. Good starting points:
+// alpha 128, beta 26 for a hand-held target; alpha 64, beta 8 for slow ones.
+typedef struct {
+    // Sliding median: ring of raw samples, and the same samples sorted in
+    // one of two buffers (swapped every update)
+    int32_t ring[SR04_MEDIAN_MAX];
+    int32_t sorted[2][SR04_MEDIAN_MAX];
+    uint8_t cur;                        // Which sorted buffer is live
+    uint8_t head;                       // Oldest sample in ring
+    uint8_t width;
+
+    // Spike gate
+    uint32_t gate_um;                   // Largest accepted innovation
+    uint8_t reacquire;                  // Rejections in a row before a reset
+    uint8_t rejects;
+
+    // Alpha-beta tracker
+    int32_t x;                          // Distance estimate
+    int32_t v;                          // Rate, per sample
+    uint16_t alpha;
+    uint16_t beta;
+    bool primed;
+} sr04_filter_t;
+
+void SR04FilterInit(sr04_filter_t *f, uint8_t width, uint16_t alpha,
+                    uint16_t beta, uint32_t gate_um, uint8_t reacquire);
+bool SR04FilterUpdate(sr04_filter_t *f, uint32_t um, uint32_t *out_um);
+uint32_t SR04FilterMiss(sr04_filter_t *f);
+
+#endif // SR04_FILTER_H
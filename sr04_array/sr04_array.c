@@ -0,0 +1,340 @@
+/******************************************************************************
+ * Project  : Ultrasonic Sensor Array (N x HC-SR04 + UART)
+ * File     : sr04_array.c
+ *
+ * Description:
+ *   Drives several HC-SR04 ultrasonic sensors from one TM4C123 and prints
+ *   their distances and the aggregate ping rate over UART 8N1.
+ *
+ *   Every echo pin is a wide timer capture input, timed in hardware on both
+ *   edges, so any number of sensors can be in flight at the same time.
+ *   Sensors that can hear each other are listed as neighbours; at start-up
+ *   they are sorted into slots so that no two neighbours share a slot. All
+ *   sensors in a slot fire together, and slots follow each other with a short
+ *   guard time so late echoes do not leak into the next slot. A slot ends as
+ *   soon as all its echoes are back, or at the 30 ms timeout.
+ *
+ *   Wiring (trigger -> echo):
+ *     S0: PE1 -> PC4 (WT0CCP0)      S1: PE2 -> PC5 (WT0CCP1)
+ *     S2: PE3 -> PC6 (WT1CCP0)      S3: PE4 -> PC7 (WT1CCP1)
+ *   The echo outputs are 5 V; use a divider or a 5 V tolerant pin.
+ *
+ * Author   : Jithin B.P.
+ * Affiliation: CSpark Research
+ * Email    : jithinuser@gmail.com
+ *
+ * License  : This source code is released under an open-source license.
+ *            You may use, modify, and distribute it freely, provided that
+ *            proper attribution is given to the original author.
+ *
+ * Created  : 2025
+ ******************************************************************************/
+#include <stdint.h>
+#include <stdbool.h>
+#include "inc/hw_memmap.h"
+#include "inc/hw_types.h"
+#include "inc/hw_gpio.h"
+#include "inc/hw_timer.h"
+#include "inc/hw_ints.h"
+#include "driverlib/sysctl.h"
+#include "driverlib/gpio.h"
+#include "driverlib/timer.h"
+#include "driverlib/interrupt.h"
+#include "driverlib/uart.h"
+#include "utils/uartstdio.h"
+#include "driverlib/pin_map.h"
+
+#define NUM_SENSORS     4
+#define MAX_SLOTS       NUM_SENSORS
+
+// The HC-SR04 holds echo high ~38 ms when nothing is in range, and its
+// rated range of 400 cm is a 23.3 ms round trip
+#define PING_TIMEOUT_US 30000
+#define MAX_ECHO_US     23300
+
+// Quiet time after a slot before the next one fires, so multipath echoes
+// from the previous slot have died out
+#define SLOT_GUARD_US   5000
+
+// Slot timer: Timer2A, full-width one-shot
+#define SLOT_TIMER      TIMER2_BASE
+#define SLOT_TIMER_INT  INT_TIMER2A
+
+// Speed of sound: 343 m/s = 0.0343 cm/us
+#define SOUND_SPEED_CM_PER_US 0.0343
+
+// Result of a ping
+typedef enum {
+    SR04_IDLE,          // No ping started
+    SR04_BUSY,          // Ping in flight
+    SR04_OK,            // Echo received, distance valid
+    SR04_NO_ECHO,       // No echo started before the timeout (sensor missing?)
+    SR04_OUT_OF_RANGE   // Echo longer than the rated range, or never ended
+} sr04_status_t;
+
+// Pins, capture timer and crosstalk neighbours of one sensor
+typedef struct {
+    uint32_t trigPort;
+    uint8_t  trigPin;
+    uint32_t echoPort;
+    uint8_t  echoPin;
+    uint32_t echoPinConfig;             // GPIO_Pxx_WTnCCPm
+    uint32_t timerBase;                 // Wide timer used for capture
+    uint32_t timerHalf;                 // TIMER_A or TIMER_B
+    uint32_t timerInt;
+    uint32_t neighbours;                // Bit i set: sensor i hears our pings
+} sr04_sensor_t;
+
+// Sensors side by side in a row: each one hears the sensors next to it
+static const sr04_sensor_t sensors[NUM_SENSORS] = {
+    {GPIO_PORTE_BASE, GPIO_PIN_1, GPIO_PORTC_BASE, GPIO_PIN_4, GPIO_PC4_WT0CCP0,
+     WTIMER0_BASE, TIMER_A, INT_WTIMER0A, 0x2},
+    {GPIO_PORTE_BASE, GPIO_PIN_2, GPIO_PORTC_BASE, GPIO_PIN_5, GPIO_PC5_WT0CCP1,
+     WTIMER0_BASE, TIMER_B, INT_WTIMER0B, 0x5},
+    {GPIO_PORTE_BASE, GPIO_PIN_3, GPIO_PORTC_BASE, GPIO_PIN_6, GPIO_PC6_WT1CCP0,
+     WTIMER1_BASE, TIMER_A, INT_WTIMER1A, 0xA},
+    {GPIO_PORTE_BASE, GPIO_PIN_4, GPIO_PORTC_BASE, GPIO_PIN_7, GPIO_PC7_WT1CCP1,
+     WTIMER1_BASE, TIMER_B, INT_WTIMER1B, 0x4},
+};
+
+// Per-sensor echo state, shared with the capture handlers
+volatile sr04_status_t sensorStatus[NUM_SENSORS];
+volatile uint32_t echoRise[NUM_SENSORS];
+volatile uint32_t echoTicks[NUM_SENSORS];
+volatile uint32_t distanceCM[NUM_SENSORS];
+volatile uint32_t lastStatus[NUM_SENSORS];
+volatile uint8_t echoGotRise;           // Bit i: sensor i saw its rising edge
+
+// Slot schedule
+uint8_t slots[MAX_SLOTS];               // Bit i: sensor i fires in this slot
+uint8_t numSlots;
+volatile uint8_t curSlot;
+volatile uint8_t slotPending;           // Sensors of curSlot still in flight
+volatile bool slotGuard;                // Slot timer is timing the guard
+volatile uint32_t pingCount;            // Completed pings, all sensors
+
+uint32_t sysClockHz;
+uint32_t maxEchoTicks;
+
+void ADCSeq0Handler(){}
+
+// UART configuration
+void ConfigureUART(void)
+{
+    SysCtlPeripheralEnable(SYSCTL_PERIPH_GPIOA);
+    SysCtlPeripheralEnable(SYSCTL_PERIPH_UART0);
+
+    GPIOPinConfigure(GPIO_PA0_U0RX);
+    GPIOPinConfigure(GPIO_PA1_U0TX);
+    GPIOPinTypeUART(GPIO_PORTA_BASE, GPIO_PIN_0 | GPIO_PIN_1);
+
+    UARTClockSourceSet(UART0_BASE, UART_CLOCK_PIOSC);
+    UARTStdioConfig(0, 115200, 16000000);
+}
+
+// Greedy colouring of the crosstalk graph: each sensor goes into the first
+// slot that holds none of its neighbours. Neighbours never fire together and
+// everything else fires in parallel.
+void SR04ArrayBuildSlots(void)
+{
+    uint8_t i, s;
+
+    numSlots = 0;
+    for (i = 0; i < NUM_SENSORS; i++) {
+        for (s = 0; s < numSlots; s++) {
+            if ((slots[s] & sensors[i].neighbours) == 0) break;
+        }
+        if (s == numSlots) slots[numSlots++] = 0;
+        slots[s] |= 1 << i;
+    }
+}
+
+// Arms the slot timer for a one-shot delay. A timeout that fired just
+// before (the last echo of a slot racing the slot timeout) is dropped, so
+// the handler only ever sees the new delay end.
+static void SR04ArrayArmSlotTimer(uint32_t us)
+{
+    TimerDisable(SLOT_TIMER, TIMER_A);
+    TimerIntClear(SLOT_TIMER, TIMER_TIMA_TIMEOUT);
+    IntPendClear(SLOT_TIMER_INT);
+    TimerLoadSet(SLOT_TIMER, TIMER_A, (sysClockHz / 1000000) * us);
+    TimerEnable(SLOT_TIMER, TIMER_A);
+}
+
+// Fires every sensor of the current slot with one shared trigger pulse
+static void SR04ArrayFireSlot(void)
+{
+    uint8_t i, mask = slots[curSlot];
+
+    slotGuard = false;
+    slotPending = mask;
+    echoGotRise &= ~mask;
+    for (i = 0; i < NUM_SENSORS; i++) {
+        if (mask & (1 << i)) sensorStatus[i] = SR04_BUSY;
+    }
+
+    SR04ArrayArmSlotTimer(PING_TIMEOUT_US);
+
+    for (i = 0; i < NUM_SENSORS; i++)
+        if (mask & (1 << i))
+            GPIOPinWrite(sensors[i].trigPort, sensors[i].trigPin, sensors[i].trigPin);
+    SysCtlDelay(sysClockHz / 300000); // ~10us
+    for (i = 0; i < NUM_SENSORS; i++)
+        if (mask & (1 << i))
+            GPIOPinWrite(sensors[i].trigPort, sensors[i].trigPin, 0);
+}
+
+// Records one result; once the whole slot is in, waits out the guard time
+static void SR04ArrayFinish(uint8_t i, sr04_status_t status, uint32_t ticks)
+{
+    sensorStatus[i] = status;
+    lastStatus[i] = status;
+    echoTicks[i] = ticks;
+    if (status == SR04_OK)
+        distanceCM[i] = (uint32_t)((ticks / (sysClockHz / 1000000.0)) *
+                                   SOUND_SPEED_CM_PER_US / 2.0);
+    echoGotRise &= ~(1 << i);
+    pingCount++;
+
+    slotPending &= ~(1 << i);
+    if (slotPending == 0 && !slotGuard) {
+        slotGuard = true;
+        SR04ArrayArmSlotTimer(SLOT_GUARD_US);
+    }
+}
+
+// Capture interrupt for sensor i: rising edge, then falling edge
+static void SR04ArrayCapture(uint8_t i)
+{
+    const sr04_sensor_t *s = &sensors[i];
+    uint32_t t, ticks;
+
+    TimerIntClear(s->timerBase, s->timerHalf == TIMER_A ? TIMER_CAPA_EVENT :
+                                                          TIMER_CAPB_EVENT);
+    t = TimerValueGet(s->timerBase, s->timerHalf);
+    if (sensorStatus[i] != SR04_BUSY) return;
+
+    if (GPIOPinRead(s->echoPort, s->echoPin) != 0) {
+        echoRise[i] = t;
+        echoGotRise |= 1 << i;
+    } else if (echoGotRise & (1 << i)) {
+        ticks = echoRise[i] - t;       // Down-counter
+        SR04ArrayFinish(i, ticks > maxEchoTicks ? SR04_OUT_OF_RANGE : SR04_OK, ticks);
+    }
+}
+
+void WTimer0AIntHandler(void) { SR04ArrayCapture(0); }
+void WTimer0BIntHandler(void) { SR04ArrayCapture(1); }
+void WTimer1AIntHandler(void) { SR04ArrayCapture(2); }
+void WTimer1BIntHandler(void) { SR04ArrayCapture(3); }
+
+// Slot timer: either the ping timeout (fail what is still in flight) or the
+// end of the guard time (fire the next slot)
+void Timer2AIntHandler(void)
+{
+    uint8_t i;
+
+    TimerIntClear(SLOT_TIMER, TIMER_TIMA_TIMEOUT);
+
+    if (!slotGuard) {
+        for (i = 0; i < NUM_SENSORS; i++) {
+            if (slotPending & (1 << i))
+                SR04ArrayFinish(i, (echoGotRise & (1 << i)) ? SR04_OUT_OF_RANGE :
+                                                              SR04_NO_ECHO, 0);
+        }
+        return;
+    }
+
+    curSlot = (curSlot + 1) % numSlots;
+    SR04ArrayFireSlot();
+}
+
+// Initialize GPIO and Timers
+void SR04ArrayInit(void)
+{
+    uint8_t i;
+
+    sysClockHz = SysCtlClockGet();
+    maxEchoTicks = (sysClockHz / 1000000) * MAX_ECHO_US;
+
+    SysCtlPeripheralEnable(SYSCTL_PERIPH_GPIOC);
+    SysCtlPeripheralEnable(SYSCTL_PERIPH_GPIOE);
+    SysCtlPeripheralEnable(SYSCTL_PERIPH_WTIMER0);
+    SysCtlPeripheralEnable(SYSCTL_PERIPH_WTIMER1);
+    SysCtlPeripheralEnable(SYSCTL_PERIPH_TIMER2);
+    while(!SysCtlPeripheralReady(SYSCTL_PERIPH_TIMER2));
+
+    // Both halves of each wide timer capture: 32-bit down-counters latched
+    // on both edges (107 s wrap at 40 MHz)
+    TimerConfigure(WTIMER0_BASE, TIMER_CFG_SPLIT_PAIR | TIMER_CFG_A_CAP_TIME |
+                                 TIMER_CFG_B_CAP_TIME);
+    TimerConfigure(WTIMER1_BASE, TIMER_CFG_SPLIT_PAIR | TIMER_CFG_A_CAP_TIME |
+                                 TIMER_CFG_B_CAP_TIME);
+
+    for (i = 0; i < NUM_SENSORS; i++) {
+        const sr04_sensor_t *s = &sensors[i];
+
+        GPIOPinTypeGPIOOutput(s->trigPort, s->trigPin);
+        GPIOPinWrite(s->trigPort, s->trigPin, 0);
+        GPIOPinConfigure(s->echoPinConfig);
+        GPIOPinTypeTimer(s->echoPort, s->echoPin);
+
+        TimerControlEvent(s->timerBase, s->timerHalf, TIMER_EVENT_BOTH_EDGES);
+        TimerLoadSet(s->timerBase, s->timerHalf, 0xFFFFFFFF);
+        TimerIntEnable(s->timerBase, s->timerHalf == TIMER_A ? TIMER_CAPA_EVENT :
+                                                               TIMER_CAPB_EVENT);
+        IntEnable(s->timerInt);
+        TimerEnable(s->timerBase, s->timerHalf);
+        sensorStatus[i] = SR04_IDLE;
+    }
+
+    // Slot timer
+    TimerConfigure(SLOT_TIMER, TIMER_CFG_ONE_SHOT);
+    TimerIntEnable(SLOT_TIMER, TIMER_TIMA_TIMEOUT);
+    IntEnable(SLOT_TIMER_INT);
+
+    SR04ArrayBuildSlots();
+}
+
+// Starts continuous round-robin ranging; results update in the background
+void SR04ArrayStart(void)
+{
+    curSlot = 0;
+    IntMasterEnable();
+    SR04ArrayFireSlot();
+}
+
+int main(void)
+{
+    uint32_t lastCount = 0, count;
+    uint8_t i;
+
+    // Run system clock at 40 MHz from PLL (16 MHz crystal / 400 MHz PLL / div10)
+    SysCtlClockSet(SYSCTL_SYSDIV_5 | SYSCTL_USE_PLL |
+                   SYSCTL_OSC_MAIN | SYSCTL_XTAL_16MHZ);
+
+    ConfigureUART();
+    UARTprintf("SR04 Ultrasonic Array Demo\n");
+
+    SR04ArrayInit();
+    UARTprintf("%d sensors in %d slots\n", NUM_SENSORS, numSlots);
+    SR04ArrayStart();
+
+    while(1)
+    {
+        SysCtlDelay(SysCtlClockGet() / 3);  // ~1s
+
+        for (i = 0; i < NUM_SENSORS; i++) {
+            if (lastStatus[i] == SR04_OK)
+                UARTprintf("S%d: %3d cm  ", i, distanceCM[i]);
+            else if (lastStatus[i] == SR04_NO_ECHO)
+                UARTprintf("S%d: ----    ", i);
+            else
+                UARTprintf("S%d: far     ", i);
+        }
+
+        count = pingCount;
+        UARTprintf("| %d pings/s\n", count - lastCount);
+        lastCount = count;
+    }
+}
@@ -0,0 +1,200 @@
+/******************************************************************************
+ * Project  : Tokenized logging host decoder
+ * File     : tlog_decode.cpp
+ *
+ * Description:
+ * Turns the binary stream written by utils/tlog.c back into text, using
+ * the tlog_table.txt that tlog_gen.py wrote for the same build.
+ *
+ *   tlog_decode <tlog_table.txt> [stream]
+ *
+ * The stream is a capture file or a serial port already set up with stty
+ * (e.g. stty -F /dev/ttyACM0 115200 raw); stdin if omitted. Bytes that do
+ * not form a known record are skipped until the next valid header.
+ *
+ * Build (Linux/macOS): g++ -O2 -std=c++17 -Wall tlog_decode.cpp -o tlog_decode
+ *
+ * Author   : Jithin B.P.
+ * Affiliation: CSpark Research
+ * Email    : jithinuser@gmail.com
+ *
+ * License  : This source code is released under an open-source license.
+ *            You may use, modify, and distribute it freely, provided that
+ *            proper attribution is given to the original author.
+ *
+ * Created  : 2025
+ ******************************************************************************/
+
+#include <cstdint>
+#include <cstdio>
+#include <fcntl.h>
+#include <unistd.h>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace {
+
+constexpr uint32_t kMagic = 0xA5;
+constexpr uint16_t kTableId = 0;
+
+struct Message {
+    unsigned nargs;
+    std::string where;
+    std::string fmt;
+};
+
+std::string Unescape(const std::string &s)
+{
+    std::string out;
+    for (size_t i = 0; i < s.size(); i++) {
+        if (s[i] != '\\' || i + 1 == s.size()) {
+            out += s[i];
+            continue;
+        }
+        switch (s[++i]) {
+        case 'n':  out += '\n'; break;
+        case 'r':  out += '\r'; break;
+        case 't':  out += '\t'; break;
+        default:   out += s[i]; break;
+        }
+    }
+    return out;
+}
+
+bool LoadTable(const char *path, std::map<uint16_t, Message> &table, uint32_t &hash)
+{
+    std::ifstream in(path);
+    std::string line;
+
+    if (!in || !std::getline(in, line) ||
+        std::sscanf(line.c_str(), "# tlog %x", &hash) != 1) {
+        std::cerr << path << ": not a tlog table\n";
+        return false;
+    }
+    while (std::getline(in, line)) {
+        std::istringstream row(line);
+        std::string id, nargs, where, fmt;
+        if (!std::getline(row, id, '\t') || !std::getline(row, nargs, '\t') ||
+            !std::getline(row, where, '\t') || !std::getline(row, fmt))
+            continue;
+        table[static_cast<uint16_t>(std::stoul(id))] =
+            Message{static_cast<unsigned>(std::stoul(nargs)), where, Unescape(fmt)};
+    }
+    return true;
+}
+
+// printf the message with its argument words. Each conversion is handed to
+// snprintf on its own, with the word as a 32-bit signed or unsigned int.
+std::string Format(const Message &msg, const uint32_t *args)
+{
+    const std::string &f = msg.fmt;
+    std::string out;
+    unsigned arg = 0;
+    char buf[64];
+
+    for (size_t i = 0; i < f.size(); i++) {
+        if (f[i] != '%') {
+            out += f[i];
+            continue;
+        }
+        size_t j = i + 1;
+        while (j < f.size() && std::string("-+ #0123456789.hl").find(f[j]) != std::string::npos)
+            j++;
+        if (j == f.size()) break;
+        char conv = f[j];
+        if (conv == '%') {
+            out += '%';
+        } else {
+            // Drop length modifiers: every argument is one 32-bit word
+            std::string spec;
+            for (size_t k = i; k < j; k++)
+                if (f[k] != 'h' && f[k] != 'l') spec += f[k];
+            spec += conv;
+            if (arg >= msg.nargs) {
+                out += "<missing>";
+            } else if (conv == 'd' || conv == 'i') {
+                std::snprintf(buf, sizeof(buf), spec.c_str(), static_cast<int32_t>(args[arg++]));
+                out += buf;
+            } else {
+                std::snprintf(buf, sizeof(buf), spec.c_str(), args[arg++]);
+                out += buf;
+            }
+        }
+        i = j;
+    }
+    return out;
+}
+
+uint32_t Word(const std::vector<uint8_t> &b, size_t at)
+{
+    return b[at] | (b[at + 1] << 8) | (b[at + 2] << 16) | (static_cast<uint32_t>(b[at + 3]) << 24);
+}
+
+} // namespace
+
+int main(int argc, char **argv)
+{
+    std::map<uint16_t, Message> table;
+    uint32_t hash;
+    int fd = 0;
+    std::vector<uint8_t> buf;
+    unsigned long skipped = 0;
+
+    if (argc < 2 || argc > 3) {
+        std::cerr << "usage: tlog_decode <tlog_table.txt> [stream]\n";
+        return 2;
+    }
+    if (!LoadTable(argv[1], table, hash)) return 1;
+    if (argc == 3 && (fd = open(argv[2], O_RDONLY)) < 0) {
+        std::perror(argv[2]);
+        return 1;
+    }
+
+    // read() returns whatever has arrived, so a live port decodes as it goes
+    uint8_t chunk[256];
+    ssize_t n;
+    while ((n = read(fd, chunk, sizeof(chunk))) > 0) {
+        buf.insert(buf.end(), chunk, chunk + n);
+
+        size_t pos = 0;
+        while (buf.size() - pos >= 4) {
+            uint32_t hdr = Word(buf, pos);
+            unsigned nargs = (hdr >> 16) & 0xFF;
+            uint16_t id = hdr & 0xFFFF;
+            auto msg = table.find(id);
+            bool known = (hdr >> 24) == kMagic &&
+                         ((id == kTableId && nargs == 1) ||
+                          (msg != table.end() && msg->second.nargs == nargs));
+
+            if (!known) {
+                pos++;
+                skipped++;
+                continue;
+            }
+            if (buf.size() - pos < 4 + 4 * nargs) break;
+
+            std::vector<uint32_t> args(nargs);
+            for (unsigned i = 0; i < nargs; i++) args[i] = Word(buf, pos + 4 + 4 * i);
+            pos += 4 + 4 * nargs;
+
+            if (skipped) {
+                std::cerr << "[tlog: skipped " << skipped << " bytes]\n";
+                skipped = 0;
+            }
+            if (id == kTableId) {
+                if (args[0] != hash)
+                    std::cerr << "[tlog: device table 0x" << std::hex << args[0]
+                              << " does not match " << argv[1] << " 0x" << hash
+                              << std::dec << "]\n";
+                continue;
+            }
+            std::cout << Format(msg->second, args.data()) << std::flush;
+        }
+        buf.erase(buf.begin(), buf.begin() + pos);
+    }
+    return 0;
+}
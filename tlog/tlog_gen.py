@@ -0,0 +1,146 @@
+#!/usr/bin/env python3
+#
+# tlog_gen.py - builds the tokenized log message table.
+#
+# Scans C sources for TLOG(NAME, "format", ...) calls and writes, into the
+# output directory:
+#   tlog_ids.h      TLOG_ID_<NAME>, TLOG_NARGS_<NAME> and TLOG_TABLE_HASH
+#   tlog_table.txt  id, argument count, source location and format, for
+#                   tlog_decode
+#
+# IDs are given in name order, starting at 1 (0 is the table hash record).
+# Files are only rewritten when their contents change, so an unchanged
+# table does not trigger a rebuild.
+#
+# Usage: tlog_gen.py <out_dir> <source file or directory>...
+#
+# Author   : Jithin B.P.
+# Affiliation: CSpark Research
+# Email    : jithinuser@gmail.com
+#
+# License  : This source code is released under an open-source license.
+#            You may use, modify, and distribute it freely, provided that
+#            proper attribution is given to the original author.
+#
+# Created  : 2025
+
+import os
+import re
+import sys
+import zlib
+
+CALL = re.compile(r'\bTLOG\s*\(\s*(\w+)\s*,\s*((?:"(?:[^"\\]|\\.)*"\s*)+)')
+LITERAL = re.compile(r'"((?:[^"\\]|\\.)*)"')
+SPEC = re.compile(r'%([-+ #0]*)(\d+|\*)?(?:\.(\d+|\*))?(hh|h|ll|l)?([a-zA-Z%])')
+INT_CONVERSIONS = 'diuxXoc'
+MAX_ARGS = 8                            # TLOG_MAX_ARGS in utils/tlog.h
+ESCAPES = {'n': '\n', 't': '\t', 'r': '\r', '\\': '\\', '"': '"', "'": "'",
+           '0': '\0', 'a': '\a'}
+
+
+def unescape(text, where):
+    out, i = [], 0
+    while i < len(text):
+        c = text[i]
+        if c != '\\':
+            out.append(c)
+            i += 1
+            continue
+        e = text[i + 1]
+        if e == 'x':
+            m = re.match(r'[0-9a-fA-F]+', text[i + 2:])
+            out.append(chr(int(m.group(0), 16)))
+            i += 2 + len(m.group(0))
+        elif e in ESCAPES:
+            out.append(ESCAPES[e])
+            i += 2
+        else:
+            sys.exit('%s: unsupported escape \\%s' % (where, e))
+    return ''.join(out)
+
+
+def table_escape(text):
+    return (text.replace('\\', '\\\\').replace('\n', '\\n')
+                .replace('\r', '\\r').replace('\t', '\\t'))
+
+
+def count_args(fmt, where):
+    n = 0
+    for m in SPEC.finditer(fmt):
+        conv = m.group(5)
+        if conv == '%':
+            continue
+        if '*' in (m.group(2) or '') + (m.group(3) or ''):
+            sys.exit('%s: "*" width/precision is not supported' % where)
+        if conv not in INT_CONVERSIONS:
+            sys.exit('%s: %%%s cannot be deferred, integers only' % (where, conv))
+        n += 1
+    return n
+
+
+def sources(paths):
+    for p in paths:
+        if os.path.isdir(p):
+            for root, _, files in os.walk(p):
+                for f in sorted(files):
+                    if f.endswith('.c'):
+                        yield os.path.join(root, f)
+        else:
+            yield p
+
+
+def write_if_changed(path, text):
+    try:
+        with open(path, newline='') as f:
+            if f.read() == text:
+                return
+    except OSError:
+        pass
+    with open(path, 'w', newline='') as f:
+        f.write(text)
+
+
+def main():
+    if len(sys.argv) < 3:
+        sys.exit('usage: tlog_gen.py <out_dir> <source file or directory>...')
+    out_dir = sys.argv[1]
+    messages = {}
+
+    for path in sources(sys.argv[2:]):
+        with open(path, newline='') as f:
+            text = f.read()
+        for m in CALL.finditer(text):
+            line = text.count('\n', 0, m.start()) + 1
+            where = '%s:%d' % (os.path.basename(path), line)
+            name = m.group(1)
+            fmt = unescape(''.join(LITERAL.findall(m.group(2))), where)
+            nargs = count_args(fmt, where)
+            if nargs > MAX_ARGS:
+                sys.exit('%s: TLOG %s has %d arguments, at most %d'
+                         % (where, name, nargs, MAX_ARGS))
+            if name in messages and messages[name][0] != fmt:
+                sys.exit('%s: TLOG name %s already used at %s with another format'
+                         % (where, name, messages[name][2]))
+            messages.setdefault(name, (fmt, nargs, where))
+
+    rows = []
+    for i, name in enumerate(sorted(messages), 1):
+        fmt, nargs, where = messages[name]
+        rows.append('%d\t%d\t%s\t%s\n' % (i, nargs, where, table_escape(fmt)))
+    table_hash = zlib.crc32(''.join(rows).encode()) & 0xFFFFFFFF
+
+    header = ['// Generated by tlog/tlog_gen.py. Do not edit.\n',
+              '#ifndef TLOG_IDS_H\n', '#define TLOG_IDS_H\n\n',
+              '#define TLOG_TABLE_HASH 0x%08XUL\n\n' % table_hash]
+    for i, name in enumerate(sorted(messages), 1):
+        header.append('#define TLOG_ID_%s %d\n' % (name, i))
+        header.append('#define TLOG_NARGS_%s %d\n' % (name, messages[name][1]))
+    header.append('\n#endif // TLOG_IDS_H\n')
+
+    write_if_changed(os.path.join(out_dir, 'tlog_ids.h'), ''.join(header))
+    write_if_changed(os.path.join(out_dir, 'tlog_table.txt'),
+                     '# tlog 0x%08X\n' % table_hash + ''.join(rows))
+
+
+if __name__ == '__main__':
+    main()
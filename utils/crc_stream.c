@@ -0,0 +1,332 @@
+/******************************************************************************
+ * Project  : TM4C123 example utilities
+ * File     : crc_stream.c
+ *
+ * Description:
+ * Streaming CRC over the hardware CRC module or driverlib's software CRCs.
+ * See crc_stream.h.
+ *
+ * Software engines keep the CRC register in the domain the input is
+ * shifted in: bit-reversed when refin is set (so the reflected tables in
+ * sw_crc.c apply directly), normal otherwise. CRC_final() converts to the
+ * output domain and applies xorout.
+ *
+ * The hardware engine is seeded with init, takes bytes (head and tail) by
+ * CPU writes and the word-aligned middle of each buffer by a uDMA
+ * software-channel transfer to its DIN register. Output reflection and
+ * xorout are done in software so every parameter set is handled the same
+ * way. The module's byte-order and bit-reversal options are the part of
+ * this that cannot be tried on a TM4C123, so the first time a parameter set
+ * would use the hardware it is run once on a test pattern and compared with
+ * the bitwise engine; on a mismatch that set stays in software.
+ *
+ * Check values ("123456789"):
+ *   CRC_32 CBF43926, CRC_32C E3069283, CRC_16_ARC BB3D,
+ *   CRC_16_MODBUS 4B37, CRC_16_CCITT_FALSE 29B1, CRC_8_SMBUS F4
+ *
+ * Author   : Jithin B.P.
+ * Affiliation: CSpark Research
+ * Email    : jithinuser@gmail.com
+ *
+ * License  : This source code is released under an open-source license.
+ * You may use, modify, and distribute it freely, provided that
+ * proper attribution is given to the original author.
+ *
+ * Created  : 2025
+ ******************************************************************************/
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "inc/hw_memmap.h"
+#include "inc/hw_ccm.h"
+#include "driverlib/sysctl.h"
+#include "driverlib/crc.h"
+#include "driverlib/sw_crc.h"
+#include "driverlib/udma.h"
+#include "dma.h"
+#include "crc_stream.h"
+
+#define CRC_HW_DMA_MIN      16          // Shorter runs are cheaper by CPU writes
+#define CRC_HW_DMA_MAX      1024        // Words per uDMA transfer
+
+const crc_params_t CRC_32             = {32, true,  true,  0x04C11DB7, 0xFFFFFFFF, 0xFFFFFFFF};
+const crc_params_t CRC_32C            = {32, true,  true,  0x1EDC6F41, 0xFFFFFFFF, 0xFFFFFFFF};
+const crc_params_t CRC_16_ARC         = {16, true,  true,  0x8005,     0x0000,     0x0000};
+const crc_params_t CRC_16_MODBUS      = {16, true,  true,  0x8005,     0xFFFF,     0x0000};
+const crc_params_t CRC_16_CCITT_FALSE = {16, false, false, 0x1021,     0xFFFF,     0x0000};
+const crc_params_t CRC_8_SMBUS        = {8,  false, false, 0x07,       0x00,       0x00};
+
+static crc_ctx_t *crc_hw_owner;         // Context using the module, if any
+static const uint8_t *crc_hw_tail;      // Bytes after the running transfer
+static uint32_t crc_hw_tail_len;
+static const crc_params_t *crc_hw_checked;  // Last set tried on the module
+static bool crc_hw_good;
+static int8_t crc_hw_present = -1;      // -1 until probed
+
+static uint32_t CRC_mask(uint8_t width)
+{
+    return (width >= 32) ? 0xFFFFFFFF : ((1u << width) - 1);
+}
+
+static uint32_t CRC_reflect(uint32_t v, uint8_t width)
+{
+    uint32_t r = 0;
+    uint8_t i;
+
+    for (i = 0; i < width; i++) {
+        r = (r << 1) | (v & 1);
+        v >>= 1;
+    }
+    return r;
+}
+
+// ------------ Software engines ------------
+
+// Which sw_crc.c table, if any, computes this parameter set
+static bool CRC_sw_table_match(const crc_params_t *p)
+{
+    if (p->refin && p->width == 32 && p->poly == 0x04C11DB7) return true;
+    if (p->refin && p->width == 16 && p->poly == 0x8005) return true;
+    if (!p->refin && p->width == 8 && p->poly == 0x07) return true;
+    return false;
+}
+
+static uint32_t CRC_sw_table(const crc_params_t *p, uint32_t crc,
+                             const uint8_t *d, uint32_t len)
+{
+    if (p->width == 32) return Crc32Slice8(crc, d, len);
+    if (p->width == 16) return Crc16((uint16_t)crc, d, len);
+    return Crc8CCITT((uint8_t)crc, d, len);
+}
+
+static uint32_t CRC_sw_bitwise(const crc_params_t *p, uint32_t crc,
+                               const uint8_t *d, uint32_t len)
+{
+    uint32_t mask = CRC_mask(p->width);
+    uint32_t top = 1u << (p->width - 1);
+    uint32_t rpoly;
+    uint8_t b;
+    int i;
+
+    if (p->refin) {
+        rpoly = CRC_reflect(p->poly, p->width);
+        while (len--) {
+            crc ^= *d++;
+            for (i = 0; i < 8; i++)
+                crc = (crc & 1) ? (crc >> 1) ^ rpoly : crc >> 1;
+        }
+    } else {
+        while (len--) {
+            b = *d++;
+            for (i = 7; i >= 0; i--) {
+                bool fb = ((crc & top) != 0) ^ ((b >> i) & 1);
+                crc = (crc << 1) & mask;
+                if (fb) crc ^= p->poly;
+            }
+        }
+    }
+    return crc & mask;
+}
+
+// ------------ Hardware engine ------------
+
+static uint32_t CRC_hw_type(const crc_params_t *p)
+{
+    if (p->width == 16 && p->poly == 0x8005) return CRC_CFG_TYPE_P8005;
+    if (p->width == 16 && p->poly == 0x1021) return CRC_CFG_TYPE_P1021;
+    if (p->width == 32 && p->poly == 0x04C11DB7) return CRC_CFG_TYPE_P4C11DB7;
+    if (p->width == 32 && p->poly == 0x1EDC6F41) return CRC_CFG_TYPE_P1EDC6F41;
+    return 0xFFFFFFFF;
+}
+
+// Control word for this set, without the input size. Bytes go in first
+// byte first, bit-reversed when refin; output reflection is done by us.
+static uint32_t CRC_hw_config(const crc_params_t *p)
+{
+    return CRC_CFG_INIT_SEED | CRC_hw_type(p) |
+           CRC_CFG_ENDIAN_SBHW | CRC_CFG_ENDIAN_SHW |
+           (p->refin ? CRC_CFG_IBR : 0);
+}
+
+static void CRC_hw_wait(void)
+{
+    while (uDMAChannelModeGet(UDMA_CHANNEL_SW | UDMA_PRI_SELECT) != UDMA_MODE_STOP);
+}
+
+static void CRC_hw_bytes(const crc_params_t *p, const uint8_t *d, uint32_t len)
+{
+    CRCConfigSet(CCM0_BASE, CRC_hw_config(p) | CRC_CFG_SIZE_8BIT);
+    while (len--)
+        CRCDataWrite(CCM0_BASE, *d++);
+}
+
+// Waits for the running transfer, then feeds the bytes that followed it
+static void CRC_hw_drain(const crc_params_t *p)
+{
+    CRC_hw_wait();
+    if (crc_hw_tail_len) {
+        CRC_hw_bytes(p, crc_hw_tail, crc_hw_tail_len);
+        crc_hw_tail_len = 0;
+    }
+}
+
+// Feeds a buffer; the last uDMA transfer is left running and whatever
+// follows it is held back until the next drain.
+static void CRC_hw_feed(const crc_params_t *p, const uint8_t *d, uint32_t len)
+{
+    uint32_t head, words, n;
+
+    CRC_hw_drain(p);
+
+    head = (4 - ((uint32_t)d & 3)) & 3;
+    if (len < head + CRC_HW_DMA_MIN) {
+        CRC_hw_bytes(p, d, len);
+        return;
+    }
+    CRC_hw_bytes(p, d, head);
+    d += head;
+    len -= head;
+
+    CRCConfigSet(CCM0_BASE, CRC_hw_config(p) | CRC_CFG_SIZE_32BIT);
+    words = len / 4;
+    while (words) {
+        n = (words > CRC_HW_DMA_MAX) ? CRC_HW_DMA_MAX : words;
+        CRC_hw_wait();
+        uDMAChannelTransferSet(UDMA_CHANNEL_SW | UDMA_PRI_SELECT, UDMA_MODE_AUTO,
+                               (void *)d, (void *)(CCM0_BASE + CCM_O_CRCDIN), n);
+        uDMAChannelEnable(UDMA_CHANNEL_SW);
+        uDMAChannelRequest(UDMA_CHANNEL_SW);
+        d += n * 4;
+        words -= n;
+    }
+
+    crc_hw_tail = d;
+    crc_hw_tail_len = len & 3;
+}
+
+static uint32_t CRC_hw_result(const crc_params_t *p)
+{
+    CRC_hw_drain(p);
+    return CRCResultRead(CCM0_BASE, false) & CRC_mask(p->width);
+}
+
+// Powers up the module and the uDMA software channel, once
+static bool CRC_hw_probe(void)
+{
+    if (crc_hw_present < 0) {
+        crc_hw_present = SysCtlPeripheralPresent(SYSCTL_PERIPH_CCM0);
+        if (crc_hw_present) {
+            SysCtlPeripheralEnable(SYSCTL_PERIPH_CCM0);
+            while(!SysCtlPeripheralReady(SYSCTL_PERIPH_CCM0));
+            DMA_init();
+            uDMAChannelAttributeDisable(UDMA_CHANNEL_SW,
+                                        UDMA_ATTR_ALTSELECT | UDMA_ATTR_USEBURST |
+                                        UDMA_ATTR_HIGH_PRIORITY | UDMA_ATTR_REQMASK);
+            uDMAChannelControlSet(UDMA_CHANNEL_SW | UDMA_PRI_SELECT,
+                                  UDMA_SIZE_32 | UDMA_SRC_INC_32 | UDMA_DST_INC_NONE |
+                                  UDMA_ARB_8);
+        }
+    }
+    return crc_hw_present > 0;
+}
+
+// Runs a misaligned pattern (byte head, uDMA middle, byte tail) through the
+// module and the bitwise engine and compares the raw registers. The bitwise
+// engine works bit-reversed for refin sets, so it is seeded and read back
+// the way CRC_init() and CRC_final() do it.
+static bool CRC_hw_check(const crc_params_t *p)
+{
+    static uint32_t pattern[8];
+    const uint8_t *d = (const uint8_t *)pattern + 1;
+    uint32_t i, sw;
+
+    for (i = 0; i < 8; i++)
+        pattern[i] = 0x9E3779B9u * (i + 1);
+
+    if (p->refin) {
+        sw = CRC_sw_bitwise(p, CRC_reflect(p->init, p->width), d, 30);
+        sw = CRC_reflect(sw, p->width);
+    } else {
+        sw = CRC_sw_bitwise(p, p->init & CRC_mask(p->width), d, 30);
+    }
+    CRC_hw_wait();
+    CRCConfigSet(CCM0_BASE, CRC_hw_config(p) | CRC_CFG_SIZE_8BIT);
+    CRCSeedSet(CCM0_BASE, p->init);
+    CRC_hw_feed(p, d, 30);
+    return CRC_hw_result(p) == sw;
+}
+
+static bool CRC_hw_usable(const crc_params_t *p)
+{
+    if (crc_hw_owner || CRC_hw_type(p) == 0xFFFFFFFF || !CRC_hw_probe())
+        return false;
+    if (crc_hw_checked != p) {
+        crc_hw_good = CRC_hw_check(p);
+        crc_hw_checked = p;
+    }
+    return crc_hw_good;
+}
+
+// ------------ API ------------
+
+void CRC_init(crc_ctx_t *c, const crc_params_t *p)
+{
+    c->p = p;
+
+    if (CRC_hw_usable(p)) {
+        c->engine = CRC_ENGINE_HW;
+        crc_hw_owner = c;
+        CRCConfigSet(CCM0_BASE, CRC_hw_config(p) | CRC_CFG_SIZE_8BIT);
+        CRCSeedSet(CCM0_BASE, p->init);
+        c->crc = 0;
+        return;
+    }
+
+    c->engine = CRC_sw_table_match(p) ? CRC_ENGINE_SW_TABLE : CRC_ENGINE_SW_BITWISE;
+    c->crc = p->refin ? CRC_reflect(p->init, p->width) : (p->init & CRC_mask(p->width));
+}
+
+void CRC_update(crc_ctx_t *c, const void *data, uint32_t len)
+{
+    if (len == 0) return;
+
+    switch (c->engine) {
+    case CRC_ENGINE_HW:
+        CRC_hw_feed(c->p, (const uint8_t *)data, len);
+        break;
+    case CRC_ENGINE_SW_TABLE:
+        c->crc = CRC_sw_table(c->p, c->crc, (const uint8_t *)data, len);
+        break;
+    default:
+        c->crc = CRC_sw_bitwise(c->p, c->crc, (const uint8_t *)data, len);
+        break;
+    }
+}
+
+// Returns the finished CRC; the context must be initialised again before
+// reuse
+uint32_t CRC_final(crc_ctx_t *c)
+{
+    const crc_params_t *p = c->p;
+    uint32_t crc = c->crc;
+    bool reflected = p->refin;          // Domain the register is in
+
+    if (c->engine == CRC_ENGINE_HW) {
+        crc = CRC_hw_result(p);
+        crc_hw_owner = 0;
+        reflected = false;
+    }
+
+    if (reflected != p->refout)
+        crc = CRC_reflect(crc, p->width);
+    return (crc ^ p->xorout) & CRC_mask(p->width);
+}
+
+uint32_t CRC_compute(const crc_params_t *p, const void *data, uint32_t len)
+{
+    crc_ctx_t c;
+
+    CRC_init(&c, p);
+    CRC_update(&c, data, len);
+    return CRC_final(&c);
+}
@@ -0,0 +1,78 @@
+/******************************************************************************
+ * Project  : TM4C123 example utilities
+ * File     : crc_stream.h
+ *
+ * Description:
+ * One streaming CRC interface (init / update / final) over every CRC engine
+ * the part has. A CRC is described by its Rocksoft parameters (width,
+ * polynomial, initial value, input/output reflection, final XOR), so the
+ * same call computes CRC-32, CRC-32C, CRC-16/ARC, Modbus, CCITT-FALSE,
+ * CRC-8 and so on.
+ *
+ * Engines, best first:
+ *   - Hardware CRC module (TM4C129 CCM0: polynomials 0x8005, 0x1021,
+ *     0x04C11DB7, 0x1EDC6F41), fed by the uDMA software channel. The
+ *     transfer runs in the background: CRC_update() returns once it is
+ *     started and the next CRC_update() or CRC_final() waits for it, so the
+ *     caller's buffer must stay untouched until then. Only one context owns
+ *     the module at a time; others use software.
+ *   - driverlib sw_crc tables (Crc32Slice8, Crc16, Crc8CCITT) when the
+ *     parameters match one of them.
+ *   - A bit-at-a-time loop for anything else.
+ *
+ * The TM4C123 has no CRC module, so on this LaunchPad the software engines
+ * are always used.
+ *
+ * Author   : Jithin B.P.
+ * Affiliation: CSpark Research
+ * Email    : jithinuser@gmail.com
+ *
+ * License  : This source code is released under an open-source license.
+ * You may use, modify, and distribute it freely, provided that
+ * proper attribution is given to the original author.
+ *
+ * Created  : 2025
+ ******************************************************************************/
+
+#ifndef CRC_STREAM_H
+#define CRC_STREAM_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+// Rocksoft model parameters; poly and init are in normal (MSB-first) form
+typedef struct {
+    uint8_t width;                      // 8, 16 or 32 (any 1..32 in software)
+    bool refin;                         // Bytes enter LSB first
+    bool refout;                        // Result is bit-reversed before xorout
+    uint32_t poly;
+    uint32_t init;
+    uint32_t xorout;
+} crc_params_t;
+
+typedef enum {
+    CRC_ENGINE_HW,                      // CRC module + uDMA
+    CRC_ENGINE_SW_TABLE,                // driverlib/sw_crc.c
+    CRC_ENGINE_SW_BITWISE
+} crc_engine_t;
+
+typedef struct {
+    const crc_params_t *p;
+    uint32_t crc;                       // Software engines: running register
+    crc_engine_t engine;
+} crc_ctx_t;
+
+// Common parameter sets. Check values for "123456789" in crc_stream.c
+extern const crc_params_t CRC_32;               // Ethernet, zip, PNG
+extern const crc_params_t CRC_32C;              // Castagnoli (iSCSI, ext4)
+extern const crc_params_t CRC_16_ARC;           // sw_crc Crc16()
+extern const crc_params_t CRC_16_MODBUS;
+extern const crc_params_t CRC_16_CCITT_FALSE;
+extern const crc_params_t CRC_8_SMBUS;          // sw_crc Crc8CCITT()
+
+void CRC_init(crc_ctx_t *c, const crc_params_t *p);
+void CRC_update(crc_ctx_t *c, const void *data, uint32_t len);
+uint32_t CRC_final(crc_ctx_t *c);
+uint32_t CRC_compute(const crc_params_t *p, const void *data, uint32_t len);
+
+#endif // CRC_STREAM_H
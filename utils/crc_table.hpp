@@ -0,0 +1,177 @@
+/******************************************************************************
+ * Project  : TM4C123 example utilities
+ * File     : crc_table.hpp
+ *
+ * Description:
+ * Compile-time CRC lookup tables for any polynomial (C++14 or later).
+ *
+ * crc::Engine<T, Width, Poly, Reflected, Init, XorOut> builds its
+ * 256-entry table in a constexpr function, so the compiler emits it as
+ * constant data (.const, i.e. flash) and no table is ever pasted by hand
+ * or built in RAM at start-up. Poly and Init are in normal (MSB-first)
+ * form, as in the usual CRC catalogues; Reflected covers both refin and
+ * refout. Widths of 8 to 32 bits are supported.
+ *
+ *   update(crc, data, n)  running CRC with no init/xorout applied, the same
+ *                         convention as driverlib/sw_crc.c
+ *   compute(data, n)      complete CRC with init and xorout
+ *
+ * crc::Crc8CCITT, crc::Crc16 and crc::Crc32 produce the same results as
+ * the sw_crc.c functions of the same name (their tables are checked
+ * against sw_crc.c entries below, at compile time). Further presets show
+ * how to add a variant: one line, no table.
+ *
+ * In CCS, enable C++14 (--c++14) for the file that includes this.
+ *
+ * Author   : Jithin B.P.
+ * Affiliation: CSpark Research
+ * Email    : jithinuser@gmail.com
+ *
+ * License  : This source code is released under an open-source license.
+ * You may use, modify, and distribute it freely, provided that
+ * proper attribution is given to the original author.
+ *
+ * Created  : 2025
+ ******************************************************************************/
+
+#ifndef CRC_TABLE_HPP
+#define CRC_TABLE_HPP
+
+#include <stdint.h>
+#include <stddef.h>
+
+namespace crc {
+
+template <typename T>
+constexpr T reflect(T v, unsigned width)
+{
+    T r = 0;
+    for (unsigned i = 0; i < width; i++) {
+        r = (T)((r << 1) | (v & 1));
+        v = (T)(v >> 1);
+    }
+    return r;
+}
+
+template <typename T, unsigned Width>
+constexpr T mask()
+{
+    return (Width >= sizeof(T) * 8) ? (T)~(T)0 : (T)(((T)1 << Width) - 1);
+}
+
+template <typename T>
+struct table_t {
+    T v[256];
+};
+
+// Builds the 256-entry table; a free function so that it is complete when
+// Table<>::table is initialised
+template <typename T, unsigned Width, T Poly, bool Reflected>
+constexpr table_t<T> make_table()
+{
+    table_t<T> t{};
+    const T top = (T)((T)1 << (Width - 1));
+    const T rpoly = reflect<T>(Poly, Width);
+
+    for (unsigned i = 0; i < 256; i++) {
+        T r = 0;
+        if (Reflected) {
+            r = (T)i;
+            for (int b = 0; b < 8; b++)
+                r = (r & 1) ? (T)((r >> 1) ^ rpoly) : (T)(r >> 1);
+        } else {
+            r = (T)((T)i << (Width - 8));
+            for (int b = 0; b < 8; b++)
+                r = (r & top) ? (T)((r << 1) ^ Poly) : (T)(r << 1);
+        }
+        t.v[i] = (T)(r & mask<T, Width>());
+    }
+    return t;
+}
+
+template <typename T, unsigned Width, T Poly, bool Reflected>
+struct Table {
+    static_assert(Width >= 8 && Width <= sizeof(T) * 8,
+                  "Width must be 8..bits of T");
+
+    static constexpr table_t<T> table = make_table<T, Width, Poly, Reflected>();
+};
+
+// C++14 needs the out-of-class definition for the table to have storage
+template <typename T, unsigned Width, T Poly, bool Reflected>
+constexpr table_t<T> Table<T, Width, Poly, Reflected>::table;
+
+template <typename T, unsigned Width, T Poly, bool Reflected,
+          T Init = 0, T XorOut = 0>
+struct Engine : Table<T, Width, Poly, Reflected> {
+    using table_type = Table<T, Width, Poly, Reflected>;
+
+    // One byte through the table
+    static constexpr T step(T crc, uint8_t b)
+    {
+        return Reflected
+            ? (T)((Width > 8 ? (crc >> 8) : 0) ^
+                  table_type::table.v[(uint8_t)(crc ^ b)])
+            : (T)(((Width > 8 ? (crc << 8) : 0) ^
+                   table_type::table.v[(uint8_t)((crc >> (Width - 8)) ^ b)]) &
+                  mask<T, Width>());
+    }
+
+    // Register value to start from: init in the shift domain
+    static constexpr T start()
+    {
+        return Reflected ? reflect<T>(Init, Width) : Init;
+    }
+
+    static T update(T crc, const uint8_t *data, uint32_t n)
+    {
+        while (n--)
+            crc = step(crc, *data++);
+        return crc;
+    }
+
+    static T compute(const void *data, uint32_t n)
+    {
+        return (T)(update(start(), (const uint8_t *)data, n) ^ XorOut);
+    }
+
+    // Compile-time CRC of a string literal (without its terminator)
+    template <size_t N>
+    static constexpr T check(const char (&s)[N])
+    {
+        T crc = start();
+        for (size_t i = 0; i + 1 < N; i++)
+            crc = step(crc, (uint8_t)s[i]);
+        return (T)(crc ^ XorOut);
+    }
+};
+
+// The sw_crc.c polynomials
+using Crc8CCITT = Engine<uint8_t, 8, 0x07, false>;
+using Crc16 = Engine<uint16_t, 16, 0x8005, true>;
+using Crc32 = Engine<uint32_t, 32, 0x04C11DB7, true, 0xFFFFFFFF, 0xFFFFFFFF>;
+
+// Variants sw_crc.c has no table for
+using Crc32C = Engine<uint32_t, 32, 0x1EDC6F41, true, 0xFFFFFFFF, 0xFFFFFFFF>;
+using Crc16Modbus = Engine<uint16_t, 16, 0x8005, true, 0xFFFF>;
+using Crc16CcittFalse = Engine<uint16_t, 16, 0x1021, false, 0xFFFF>;
+
+// Spot checks against the tables in sw_crc.c
+static_assert(Crc8CCITT::table.v[1] == 0x07 && Crc8CCITT::table.v[255] == 0xF3,
+              "CRC-8 table differs from sw_crc.c");
+static_assert(Crc16::table.v[1] == 0xC0C1 && Crc16::table.v[255] == 0x4040,
+              "CRC-16 table differs from sw_crc.c");
+static_assert(Crc32::table.v[1] == 0x77073096 && Crc32::table.v[255] == 0x2D02EF8D,
+              "CRC-32 table differs from sw_crc.c");
+
+// Catalogue check values
+static_assert(Crc32::check("123456789") == 0xCBF43926, "CRC-32 check");
+static_assert(Crc32C::check("123456789") == 0xE3069283, "CRC-32C check");
+static_assert(Crc16::check("123456789") == 0xBB3D, "CRC-16/ARC check");
+static_assert(Crc16Modbus::check("123456789") == 0x4B37, "CRC-16/MODBUS check");
+static_assert(Crc16CcittFalse::check("123456789") == 0x29B1, "CRC-16/CCITT-FALSE check");
+static_assert(Crc8CCITT::check("123456789") == 0xF4, "CRC-8 check");
+
+} // namespace crc
+
+#endif // CRC_TABLE_HPP
@@ -0,0 +1,60 @@
+/******************************************************************************
+ * Project  : TM4C123 example utilities
+ * File     : dma.c
+ *
+ * Description:
+ * Shared uDMA control table and error handler. See dma.h.
+ *
+ * Author   : Jithin B.P.
+ * Affiliation: CSpark Research
+ * Email    : jithinuser@gmail.com
+ *
+ * License  : This source code is released under an open-source license.
+ * You may use, modify, and distribute it freely, provided that
+ * proper attribution is given to the original author.
+ *
+ * Created  : 2025
+ ******************************************************************************/
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "inc/hw_memmap.h"
+#include "inc/hw_ints.h"
+#include "driverlib/sysctl.h"
+#include "driverlib/interrupt.h"
+#include "driverlib/udma.h"
+#include "dma.h"
+
+// The control table must be 1024-byte aligned (64 channels, primary and
+// alternate, 16 bytes each)
+#if defined(ccs) || defined(__TI_COMPILER_VERSION__)
+#pragma DATA_ALIGN(dma_control_table, 1024)
+static uint8_t dma_control_table[1024];
+#else
+static uint8_t dma_control_table[1024] __attribute__((aligned(1024)));
+#endif
+
+volatile uint32_t dma_errors;
+static bool dma_ready;
+
+// Powers up the uDMA controller and points it at the shared table
+void DMA_init(void)
+{
+    if (dma_ready) return;
+
+    SysCtlPeripheralEnable(SYSCTL_PERIPH_UDMA);
+    while(!SysCtlPeripheralReady(SYSCTL_PERIPH_UDMA));
+    uDMAEnable();
+    uDMAControlBaseSet(dma_control_table);
+    IntEnable(INT_UDMAERR);
+    dma_ready = true;
+}
+
+// uDMA bus error: clear it so the controller keeps running, and count it
+void uDMAErrorHandler(void)
+{
+    if (uDMAErrorStatusGet()) {
+        uDMAErrorStatusClear();
+        dma_errors++;
+    }
+}
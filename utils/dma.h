@@ -0,0 +1,30 @@
+/******************************************************************************
+ * Project  : TM4C123 example utilities
+ * File     : dma.h
+ *
+ * Description:
+ * One uDMA channel control table for the whole program. Every driver that
+ * uses uDMA calls DMA_init() first; only the first call does anything.
+ *
+ * Author   : Jithin B.P.
+ * Affiliation: CSpark Research
+ * Email    : jithinuser@gmail.com
+ *
+ * License  : This source code is released under an open-source license.
+ * You may use, modify, and distribute it freely, provided that
+ * proper attribution is given to the original author.
+ *
+ * Created  : 2025
+ ******************************************************************************/
+
+#ifndef DMA_H
+#define DMA_H
+
+#include <stdint.h>
+
+extern volatile uint32_t dma_errors;    // Bus errors seen by uDMAErrorHandler
+
+void DMA_init(void);
+void uDMAErrorHandler(void);
+
+#endif // DMA_H
@@ -0,0 +1,149 @@
+/******************************************************************************
+ * Project  : TM4C123 example utilities
+ * File     : fmt.c
+ *
+ * Description:
+ * Item-list formatter and RAM buffer sink. See fmt.h.
+ *
+ * Author   : Jithin B.P.
+ * Affiliation: CSpark Research
+ * Email    : jithinuser@gmail.com
+ *
+ * License  : This source code is released under an open-source license.
+ * You may use, modify, and distribute it freely, provided that
+ * proper attribution is given to the original author.
+ *
+ * Created  : 2025
+ ******************************************************************************/
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "fmt.h"
+
+static const uint32_t fmt_pow10[10] = {
+    1, 10, 100, 1000, 10000, 100000, 1000000, 10000000, 100000000, 1000000000
+};
+
+// Writes v in decimal, backwards from end. Returns the new start.
+static char *fmt_dec(char *end, uint32_t v)
+{
+    do {
+        *--end = '0' + v % 10;
+        v /= 10;
+    } while (v);
+    return end;
+}
+
+static void fmt_pad(fmt_sink_t *sink, char pad, uint32_t n)
+{
+    static const char spaces[8] = {' ', ' ', ' ', ' ', ' ', ' ', ' ', ' '};
+    static const char zeros[8] = {'0', '0', '0', '0', '0', '0', '0', '0'};
+
+    while (n) {
+        uint32_t k = n > 8 ? 8 : n;
+        sink->put(sink, pad == '0' ? zeros : spaces, k);
+        n -= k;
+    }
+}
+
+// Sends the field [p, end) right-aligned in width
+static void fmt_field(fmt_sink_t *sink, const char *p, const char *end,
+                      uint8_t width, char pad)
+{
+    uint32_t len = end - p;
+
+    if (width > len) fmt_pad(sink, pad, width - len);
+    sink->put(sink, p, len);
+}
+
+void fmt_print(fmt_sink_t *sink, const fmt_item_t *items)
+{
+    char buf[24];
+    char *end = buf + sizeof(buf), *p;
+    const char *s;
+    uint32_t a, ip, fp, unit;
+    uint8_t scale, frac, i;
+    bool neg;
+
+    for (; items->type != FMT_T_END; items++) {
+        switch (items->type) {
+        case FMT_T_STR:
+            for (s = items->v.s; *s; s++);
+            sink->put(sink, items->v.s, s - items->v.s);
+            break;
+
+        case FMT_T_CHAR:
+            buf[0] = (char)items->v.u;
+            sink->put(sink, buf, 1);
+            break;
+
+        case FMT_T_INT:
+            a = items->v.i < 0 ? 0u - (uint32_t)items->v.i : (uint32_t)items->v.i;
+            p = fmt_dec(end, a);
+            if (items->v.i < 0) *--p = '-';
+            fmt_field(sink, p, end, items->width, ' ');
+            break;
+
+        case FMT_T_UINT:
+            fmt_field(sink, fmt_dec(end, items->v.u), end, items->width, ' ');
+            break;
+
+        case FMT_T_HEX:
+            p = end;
+            a = items->v.u;
+            do {
+                *--p = "0123456789ABCDEF"[a & 0xF];
+                a >>= 4;
+            } while (a);
+            fmt_field(sink, p, end, items->width, '0');
+            break;
+
+        case FMT_T_FIX:
+        case FMT_T_UFIX:
+            // FMT_FIX checks these at compile time; clamp hand-built items
+            scale = items->scale < FMT_SCALE_MAX ? items->scale : FMT_SCALE_MAX;
+            frac = items->frac < scale ? items->frac : scale;
+            neg = items->type == FMT_T_FIX && items->v.i < 0;
+            a = neg ? 0u - (uint32_t)items->v.i : items->v.u;
+            unit = fmt_pow10[scale - frac];
+            a = a / unit + (a % unit >= (unit + 1) / 2);    // Round half up
+            ip = a / fmt_pow10[frac];
+            fp = a % fmt_pow10[frac];
+
+            p = end;
+            if (frac) {
+                for (i = 0; i < frac; i++) {
+                    *--p = '0' + fp % 10;
+                    fp /= 10;
+                }
+                *--p = '.';
+            }
+            p = fmt_dec(p, ip);
+            if (neg && a) *--p = '-';
+            fmt_field(sink, p, end, items->width, ' ');
+            break;
+
+        default:
+            break;
+        }
+    }
+}
+
+static void fmt_buf_put(fmt_sink_t *sink, const char *s, uint32_t len)
+{
+    fmt_buf_t *b = (fmt_buf_t *)sink;
+
+    while (len-- && b->len + 1 < b->size) b->buf[b->len++] = *s++;
+    b->buf[b->len] = '\0';
+}
+
+// Sets up a RAM sink over buf and returns it, empty
+fmt_sink_t *fmt_buf_init(fmt_buf_t *b, char *buf, uint32_t size)
+{
+    b->sink.put = fmt_buf_put;
+    b->buf = buf;
+    b->size = size;
+    b->len = 0;
+    if (size) buf[0] = '\0';
+    return &b->sink;
+}
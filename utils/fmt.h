@@ -0,0 +1,115 @@
+/******************************************************************************
+ * Project  : TM4C123 example utilities
+ * File     : fmt.h
+ *
+ * Description:
+ * Small type-checked text formatter. Instead of a format string parsed at
+ * run time, a message is a list of typed items built at compile time:
+ *
+ *   FMT_PRINT(&uart_tx_sink, FMT_S("Distance: "), FMT_UFIX(um, 4, 2, 0),
+ *             FMT_S(" cm\n"));
+ *
+ * Each integer item goes through _Generic, so passing a float, pointer or
+ * struct where an integer is expected fails to compile, and there is no
+ * format/argument mismatch to get wrong. The signed items (FMT_I, FMT_FIX)
+ * also refuse unsigned int and long, which could exceed INT32_MAX and print
+ * as negative; use FMT_U or FMT_UFIX for those. fmt_print() just walks the
+ * list.
+ *
+ * Output goes to a sink: anything with a put() function. fmt.c provides a
+ * RAM buffer sink (for LCD lines and log records); uart_dma.c provides
+ * uart_tx_sink; an LCD example wraps its LCD_data() in a few lines.
+ *
+ * Author   : Jithin B.P.
+ * Affiliation: CSpark Research
+ * Email    : jithinuser@gmail.com
+ *
+ * License  : This source code is released under an open-source license.
+ * You may use, modify, and distribute it freely, provided that
+ * proper attribution is given to the original author.
+ *
+ * Created  : 2025
+ ******************************************************************************/
+
+#ifndef FMT_H
+#define FMT_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+typedef struct fmt_sink fmt_sink_t;
+
+// Output backend: put() receives len bytes, not NUL-terminated
+struct fmt_sink {
+    void (*put)(fmt_sink_t *sink, const char *s, uint32_t len);
+};
+
+// RAM sink: keeps a NUL-terminated string, truncates when full
+typedef struct {
+    fmt_sink_t sink;
+    char *buf;
+    uint32_t size;
+    uint32_t len;
+} fmt_buf_t;
+
+typedef enum {
+    FMT_T_END,
+    FMT_T_STR,
+    FMT_T_CHAR,
+    FMT_T_INT,                          // Signed decimal
+    FMT_T_UINT,                         // Unsigned decimal
+    FMT_T_HEX,                          // Upper-case hex, zero-padded to width
+    FMT_T_FIX,                          // Scaled integer as a decimal fraction
+    FMT_T_UFIX                          // FIX, unsigned
+} fmt_type_t;
+
+typedef struct {
+    uint8_t type;
+    uint8_t width;                      // Minimum width, right-aligned
+    uint8_t scale;                      // FIX: value is in units of 10^-scale
+    uint8_t frac;                       // FIX: digits shown after the point
+    union {
+        const char *s;
+        int32_t i;
+        uint32_t u;
+    } v;
+} fmt_item_t;
+
+// Only integer types are accepted; anything else has no _Generic match
+#define FMT_INT_(x) _Generic((x),                                             \
+    _Bool: (x), char: (x), signed char: (x), unsigned char: (x),             \
+    short: (x), unsigned short: (x), int: (x), unsigned int: (x),            \
+    long: (x), unsigned long: (x))
+
+// Integer types that fit in int32_t on the target (long is 32 bits)
+#define FMT_SINT_(x) _Generic((x),                                            \
+    _Bool: (x), char: (x), signed char: (x), unsigned char: (x),             \
+    short: (x), unsigned short: (x), int: (x), long: (x))
+
+#define FMT_S(str)          ((fmt_item_t){FMT_T_STR, 0, 0, 0, {.s = (str)}})
+#define FMT_C(c)            ((fmt_item_t){FMT_T_CHAR, 0, 0, 0, {.u = (uint8_t)FMT_INT_(c)}})
+#define FMT_I(x, w)         ((fmt_item_t){FMT_T_INT, (w), 0, 0, {.i = (int32_t)FMT_SINT_(x)}})
+#define FMT_U(x, w)         ((fmt_item_t){FMT_T_UINT, (w), 0, 0, {.u = (uint32_t)FMT_INT_(x)}})
+#define FMT_X(x, w)         ((fmt_item_t){FMT_T_HEX, (w), 0, 0, {.u = (uint32_t)FMT_INT_(x)}})
+// x / 10^scale rounded to frac decimals, e.g. FMT_FIX(215, 1, 1, 0) -> "21.5";
+// FMT_UFIX takes unsigned values up to UINT32_MAX.
+// scale and frac must be constants with frac <= scale <= FMT_SCALE_MAX; a
+// bad pair fails to compile (negative bit-field width).
+#define FMT_SCALE_MAX   9
+#define FMT_FIX(x, scale, frac, w)                                            \
+    ((fmt_item_t){FMT_T_FIX, (w), (scale) + FMT_FIX_OK_(scale, frac), (frac), \
+                  {.i = (int32_t)FMT_SINT_(x)}})
+#define FMT_UFIX(x, scale, frac, w)                                           \
+    ((fmt_item_t){FMT_T_UFIX, (w), (scale) + FMT_FIX_OK_(scale, frac), (frac), \
+                  {.u = (uint32_t)FMT_INT_(x)}})
+#define FMT_FIX_OK_(scale, frac)                                              \
+    (0 * sizeof(struct { int fmt_fix_ :                                       \
+        ((scale) <= FMT_SCALE_MAX && (frac) <= (scale)) ? 1 : -1; }))
+
+#define FMT_PRINT(sink, ...)                                                  \
+    fmt_print((sink), (const fmt_item_t[]){ __VA_ARGS__, {FMT_T_END, 0, 0, 0, {0}} })
+
+void fmt_print(fmt_sink_t *sink, const fmt_item_t *items);
+fmt_sink_t *fmt_buf_init(fmt_buf_t *b, char *buf, uint32_t size);
+
+#endif // FMT_H
@@ -0,0 +1,105 @@
+/******************************************************************************
+ * Project  : TM4C123 example utilities
+ * File     : gcm_stream.c
+ *
+ * Description:
+ * Chunked AES-GCM encryption into a send function. See gcm_stream.h.
+ *
+ * Each full chunk is encrypted in place with SWAESGCMUpdate(), which also
+ * folds it into the tag, and copied into the sender's ring; the uDMA
+ * channel then empties the ring while the next chunk is being gathered and
+ * encrypted. Nothing here depends on the total length, so the stream may
+ * run for as long as the 2^32 byte limit of one GCM message allows.
+ *
+ * Author   : Jithin B.P.
+ * Affiliation: CSpark Research
+ * Email    : jithinuser@gmail.com
+ *
+ * License  : This source code is released under an open-source license.
+ * You may use, modify, and distribute it freely, provided that
+ * proper attribution is given to the original author.
+ *
+ * Created  : 2025
+ ******************************************************************************/
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include "driverlib/aes.h"
+#include "driverlib/sw_aes.h"
+#include "gcm_stream.h"
+
+static void GCM_stream_send(gcm_stream_t *s, const void *buf, uint32_t len)
+{
+    if (s->send(buf, len))
+        return;
+    s->stalls++;
+    while (!s->send(buf, len));
+}
+
+static void GCM_stream_flush(gcm_stream_t *s)
+{
+    if (s->fill == 0)
+        return;
+    SWAESGCMUpdate(&s->aes, s->chunk, s->chunk, s->fill);
+    GCM_stream_send(s, s->chunk, s->fill);
+    s->fill = 0;
+}
+
+// key_bits is 128, 192 or 256; iv is 12 bytes and must never repeat under
+// the same key. Returns false for any other key size.
+bool GCM_stream_begin(gcm_stream_t *s, const uint32_t *key, uint32_t key_bits,
+                      const uint8_t *iv, const void *aad, uint32_t aad_len,
+                      gcm_send_t send)
+{
+    uint32_t iv_words[4] = {0};
+    uint32_t key_size;
+
+    if (key_bits == 128)      key_size = AES_CFG_KEY_SIZE_128BIT;
+    else if (key_bits == 192) key_size = AES_CFG_KEY_SIZE_192BIT;
+    else if (key_bits == 256) key_size = AES_CFG_KEY_SIZE_256BIT;
+    else return false;
+
+    SWAESConfigSet(&s->aes, AES_CFG_DIR_ENCRYPT | AES_CFG_MODE_GCM_HY0CALC);
+    SWAESKey1Set(&s->aes, key, key_size);
+    memcpy(iv_words, iv, 12);
+    SWAESIVSet(&s->aes, iv_words);
+
+    s->send = send;
+    s->fill = 0;
+    s->stalls = 0;
+    return SWAESGCMStart(&s->aes, aad, aad_len);
+}
+
+// Any length, any alignment. Returns once the data is encrypted and queued
+// (or waiting in the chunk buffer); it blocks only while the sender is full.
+void GCM_stream_write(gcm_stream_t *s, const void *data, uint32_t len)
+{
+    const uint8_t *d = data;
+    uint32_t n;
+
+    while (len) {
+        n = GCM_STREAM_CHUNK - s->fill;
+        if (n > len) n = len;
+        memcpy(s->chunk + s->fill, d, n);
+        s->fill += n;
+        d += n;
+        len -= n;
+        if (s->fill == GCM_STREAM_CHUNK)
+            GCM_stream_flush(s);
+    }
+}
+
+// Sends what is left and the tag, and also writes the tag to tag (may be
+// NULL). The context must be begun again for the next message.
+void GCM_stream_end(gcm_stream_t *s, uint8_t *tag)
+{
+    uint32_t t[4];
+
+    GCM_stream_flush(s);
+    SWAESGCMFinish(&s->aes, t);
+    GCM_stream_send(s, t, GCM_TAG_SIZE);
+    if (tag)
+        memcpy(tag, t, GCM_TAG_SIZE);
+    memset(&s->aes, 0, sizeof(s->aes));
+}
@@ -0,0 +1,60 @@
+/******************************************************************************
+ * Project  : TM4C123 example utilities
+ * File     : gcm_stream.h
+ *
+ * Description:
+ * AES-GCM encryption of a stream of any length with constant RAM: one
+ * software AES context and one chunk buffer. Data is collected into the
+ * chunk, encrypted and hashed in place, and handed to a send function,
+ * normally UART_tx_send(), whose uDMA channel drains it to the UART while
+ * the CPU encrypts the next chunk. When the sender is full the writer waits
+ * (backpressure), so the stream runs at the slower of the cipher and the
+ * line.
+ *
+ * Output: the ciphertext, in the order written, then the 16-byte tag.
+ *
+ * The TM4C123 has no AES module, so driverlib/sw_aes.c does the cipher;
+ * the uDMA work is on the output side. The TM4C129 AES module's GCM mode
+ * needs the total length before the first block, which a stream of unknown
+ * length does not have.
+ *
+ * Author   : Jithin B.P.
+ * Affiliation: CSpark Research
+ * Email    : jithinuser@gmail.com
+ *
+ * License  : This source code is released under an open-source license.
+ * You may use, modify, and distribute it freely, provided that
+ * proper attribution is given to the original author.
+ *
+ * Created  : 2025
+ ******************************************************************************/
+
+#ifndef GCM_STREAM_H
+#define GCM_STREAM_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "driverlib/sw_aes.h"
+
+#define GCM_STREAM_CHUNK    256         // Bytes per send; at most UART_TX_RING_SIZE
+#define GCM_TAG_SIZE        16
+
+// Queues len bytes, all or nothing; false if there is no room yet
+// (UART_tx_send() has this shape)
+typedef bool (*gcm_send_t)(const void *buf, uint32_t len);
+
+typedef struct {
+    tSWAESContext aes;
+    gcm_send_t send;
+    uint8_t chunk[GCM_STREAM_CHUNK];
+    uint32_t fill;
+    uint32_t stalls;                    // Sends that had to wait for room
+} gcm_stream_t;
+
+bool GCM_stream_begin(gcm_stream_t *s, const uint32_t *key, uint32_t key_bits,
+                      const uint8_t *iv, const void *aad, uint32_t aad_len,
+                      gcm_send_t send);
+void GCM_stream_write(gcm_stream_t *s, const void *data, uint32_t len);
+void GCM_stream_end(gcm_stream_t *s, uint8_t *tag);
+
+#endif // GCM_STREAM_H
@@ -0,0 +1,309 @@
+/******************************************************************************
+ * Project  : TM4C123 example utilities
+ * File     : hash_stream.c
+ *
+ * Description:
+ * Incremental SHA-224 / SHA-256 and HMAC over the hardware SHA/MD5 module
+ * or driverlib's software SHA-256. See hash_stream.h.
+ *
+ * The module only continues a hash across runs in whole blocks, and only
+ * closes one that has data in its last run, so the context always holds
+ * back 1 to 64 bytes: HASH_update() hands the module every block but the
+ * last, and HASH_final() sends what is held with CLOSE_HASH. A message
+ * that never fills a block is hashed in software from the held bytes.
+ *
+ * HMAC is built on the plain hash (inner and outer passes with the padded
+ * key), so it works the same on either engine and keys of any length.
+ *
+ * Author   : Jithin B.P.
+ * Affiliation: CSpark Research
+ * Email    : jithinuser@gmail.com
+ *
+ * License  : This source code is released under an open-source license.
+ * You may use, modify, and distribute it freely, provided that
+ * proper attribution is given to the original author.
+ *
+ * Created  : 2025
+ ******************************************************************************/
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include "inc/hw_memmap.h"
+#include "inc/hw_types.h"
+#include "inc/hw_shamd5.h"
+#include "driverlib/sysctl.h"
+#include "driverlib/shamd5.h"
+#include "driverlib/sw_shamd5.h"
+#include "hash_stream.h"
+
+static int8_t hash_hw_present = -1;     // -1 until probed
+static int8_t hash_hw_good[2] = {-1, -1};   // Per algorithm, -1 until checked
+
+static uint32_t HASH_sw_mode(hash_algo_t algo)
+{
+    return (algo == HASH_SHA224) ? SHAMD5_ALGO_SHA224 : SHAMD5_ALGO_SHA256;
+}
+
+static uint32_t HASH_hw_algo(hash_algo_t algo)
+{
+    return (algo == HASH_SHA224) ? SHAMD5_MODE_ALGO_SHA224 : SHAMD5_MODE_ALGO_SHA256;
+}
+
+// ------------ Hardware engine ------------
+
+static void HASH_hw_wait(uint32_t flag)
+{
+    while ((HWREG(SHAMD5_BASE + SHAMD5_O_IRQSTATUS) & flag) == 0);
+}
+
+// Loads the saved state (or the algorithm constants for a first run) and
+// the mode, then the length, which starts the run
+static void HASH_hw_begin(hash_ctx_t *c, uint32_t mode, uint32_t len)
+{
+    uint32_t i;
+
+    HASH_hw_wait(SHAMD5_INT_CONTEXT_READY);
+    if (c->u.hw.started) {
+        for (i = 0; i < 8; i++)
+            HWREG(SHAMD5_BASE + SHAMD5_O_IDIGEST_A + i * 4) = c->u.hw.digest[i];
+        HWREG(SHAMD5_BASE + SHAMD5_O_DIGEST_COUNT) = c->u.hw.count;
+    } else {
+        mode |= SHAMD5_MODE_ALGO_CONSTANT;
+    }
+    HWREG(SHAMD5_BASE + SHAMD5_O_MODE) = HASH_hw_algo(c->algo) | mode;
+    HWREG(SHAMD5_BASE + SHAMD5_O_LENGTH) = len;
+}
+
+// One block of up to 64 bytes, any alignment, as little-endian words
+static void HASH_hw_block(const uint8_t *d, uint32_t len)
+{
+    uint32_t i;
+
+    HASH_hw_wait(SHAMD5_INT_INPUT_READY);
+    for (i = 0; i < len; i += 4, d += 4)
+        HWREG(SHAMD5_BASE + SHAMD5_O_DATA_0_IN + i) =
+            d[0] | (d[1] << 8) | ((uint32_t)d[2] << 16) | ((uint32_t)d[3] << 24);
+}
+
+// Hashes whole blocks and saves the intermediate state
+static void HASH_hw_blocks(hash_ctx_t *c, const uint8_t *d, uint32_t blocks)
+{
+    uint32_t i;
+
+    HASH_hw_begin(c, 0, blocks * HASH_BLOCK);
+    for (i = 0; i < blocks; i++, d += HASH_BLOCK)
+        HASH_hw_block(d, HASH_BLOCK);
+    HASH_hw_wait(SHAMD5_INT_OUTPUT_READY);
+
+    for (i = 0; i < 8; i++)
+        c->u.hw.digest[i] = HWREG(SHAMD5_BASE + SHAMD5_O_IDIGEST_A + i * 4);
+    c->u.hw.count = HWREG(SHAMD5_BASE + SHAMD5_O_DIGEST_COUNT);
+    c->u.hw.started = true;
+}
+
+static void HASH_hw_update(hash_ctx_t *c, const uint8_t *d, uint32_t len)
+{
+    uint32_t n;
+
+    while (len) {
+        if (c->u.hw.fill == HASH_BLOCK) {
+            HASH_hw_blocks(c, c->u.hw.block, 1);
+            c->u.hw.fill = 0;
+        }
+        // Straight from the caller's buffer, keeping at least one byte back
+        if (c->u.hw.fill == 0 && len > HASH_BLOCK) {
+            n = (len - 1) / HASH_BLOCK;
+            HASH_hw_blocks(c, d, n);
+            d += n * HASH_BLOCK;
+            len -= n * HASH_BLOCK;
+        }
+        n = HASH_BLOCK - c->u.hw.fill;
+        if (n > len) n = len;
+        memcpy(c->u.hw.block + c->u.hw.fill, d, n);
+        c->u.hw.fill += n;
+        d += n;
+        len -= n;
+    }
+}
+
+static void HASH_hw_final(hash_ctx_t *c, uint8_t *digest)
+{
+    uint32_t words[8], i;
+
+    if (!c->u.hw.started) {
+        tSWSHAMD5Context sw;
+
+        SWSHAMD5ConfigSet(&sw, HASH_sw_mode(c->algo));
+        SWSHAMD5DataProcess(&sw, (const uint32_t *)c->u.hw.block, c->u.hw.fill, words);
+    } else {
+        // The block buffer is whole, so the last word may be read past fill
+        HASH_hw_begin(c, SHAMD5_MODE_CLOSE_HASH, c->u.hw.fill);
+        HASH_hw_block(c->u.hw.block, c->u.hw.fill);
+        HASH_hw_wait(SHAMD5_INT_OUTPUT_READY);
+        for (i = 0; i < 8; i++)
+            words[i] = HWREG(SHAMD5_BASE + SHAMD5_O_IDIGEST_A + i * 4);
+    }
+    memcpy(digest, words, HASH_size(c->algo));
+}
+
+// Powers up the module, once
+static bool HASH_hw_probe(void)
+{
+    if (hash_hw_present < 0) {
+        hash_hw_present = SysCtlPeripheralPresent(SYSCTL_PERIPH_CCM0);
+        if (hash_hw_present) {
+            SysCtlPeripheralEnable(SYSCTL_PERIPH_CCM0);
+            while (!SysCtlPeripheralReady(SYSCTL_PERIPH_CCM0));
+            SHAMD5Reset(SHAMD5_BASE);
+        }
+    }
+    return hash_hw_present > 0;
+}
+
+// Hashes a pattern in uneven, misaligned chunks through the module (so it
+// crosses the save/restore path several times) and in software, and
+// compares. The state registers' byte order is the part that cannot be
+// tried on a TM4C123.
+static bool HASH_hw_check(hash_algo_t algo)
+{
+    static uint32_t pattern[64];
+    const uint8_t *d = (const uint8_t *)pattern + 1;
+    uint8_t hw[HASH_MAX_DIGEST], sw[HASH_MAX_DIGEST];
+    tSWSHAMD5Context s;
+    hash_ctx_t c;
+    uint32_t i;
+
+    for (i = 0; i < 64; i++)
+        pattern[i] = 0x9E3779B9u * (i + 1);
+
+    SWSHAMD5ConfigSet(&s, HASH_sw_mode(algo));
+    SWSHAMD5DataProcess(&s, (const uint32_t *)d, 250, (uint32_t *)sw);
+
+    c.algo = algo;
+    c.u.hw.fill = 0;
+    c.u.hw.started = false;
+    HASH_hw_update(&c, d, 1);
+    HASH_hw_update(&c, d + 1, 70);
+    HASH_hw_update(&c, d + 71, 115);
+    HASH_hw_update(&c, d + 186, 64);
+    HASH_hw_final(&c, hw);
+    return memcmp(hw, sw, HASH_size(algo)) == 0;
+}
+
+static bool HASH_hw_usable(hash_algo_t algo)
+{
+    if (!HASH_hw_probe())
+        return false;
+    if (hash_hw_good[algo] < 0)
+        hash_hw_good[algo] = HASH_hw_check(algo);
+    return hash_hw_good[algo] > 0;
+}
+
+// ------------ API ------------
+
+uint32_t HASH_size(hash_algo_t algo)
+{
+    return (algo == HASH_SHA224) ? 28 : 32;
+}
+
+void HASH_init(hash_ctx_t *c, hash_algo_t algo)
+{
+    c->algo = algo;
+    c->hmac = false;
+
+    if (HASH_hw_usable(algo)) {
+        c->engine = HASH_ENGINE_HW;
+        c->u.hw.fill = 0;
+        c->u.hw.started = false;
+        return;
+    }
+
+    c->engine = HASH_ENGINE_SW;
+    SWSHAMD5ConfigSet(&c->u.sw, HASH_sw_mode(algo));
+    SWSHAMD5HashStart(&c->u.sw);
+}
+
+// Clears key material. The volatile stores cannot be dropped as dead, the
+// way a memset() of a buffer about to go out of scope can be.
+static void HASH_wipe(void *p, uint32_t len)
+{
+    volatile uint8_t *b = (volatile uint8_t *)p;
+
+    while (len--)
+        *b++ = 0;
+}
+
+// Inner hash of H((K ^ opad) || H((K ^ ipad) || message)); a key longer
+// than a block is hashed first, as RFC 2104 says
+void HASH_hmac_init(hash_ctx_t *c, hash_algo_t algo, const void *key, uint32_t key_len)
+{
+    uint8_t pad[HASH_BLOCK];
+    uint32_t i;
+
+    memset(c->key, 0, HASH_BLOCK);
+    if (key_len > HASH_BLOCK)
+        HASH_compute(algo, key, key_len, c->key);
+    else
+        memcpy(c->key, key, key_len);
+
+    HASH_init(c, algo);
+    c->hmac = true;
+    for (i = 0; i < HASH_BLOCK; i++)
+        pad[i] = c->key[i] ^ 0x36;
+    HASH_update(c, pad, HASH_BLOCK);
+    HASH_wipe(pad, HASH_BLOCK);
+}
+
+void HASH_update(hash_ctx_t *c, const void *data, uint32_t len)
+{
+    if (c->engine == HASH_ENGINE_HW)
+        HASH_hw_update(c, (const uint8_t *)data, len);
+    else
+        SWSHAMD5HashUpdate(&c->u.sw, data, len);
+}
+
+static void HASH_finish(hash_ctx_t *c, uint8_t *digest)
+{
+    uint32_t words[8];
+
+    if (c->engine == HASH_ENGINE_HW) {
+        HASH_hw_final(c, digest);
+    } else {
+        SWSHAMD5HashFinish(&c->u.sw, words);
+        memcpy(digest, words, HASH_size(c->algo));
+    }
+}
+
+// Writes HASH_size() bytes; the context must be initialised again before
+// reuse. After an HMAC the whole context is cleared, since the key block
+// and the state after K ^ ipad would both let a MAC be forged.
+void HASH_final(hash_ctx_t *c, uint8_t *digest)
+{
+    uint8_t inner[HASH_MAX_DIGEST], pad[HASH_BLOCK];
+    uint32_t i;
+
+    HASH_finish(c, c->hmac ? inner : digest);
+    if (!c->hmac)
+        return;
+
+    for (i = 0; i < HASH_BLOCK; i++)
+        pad[i] = c->key[i] ^ 0x5C;
+    HASH_init(c, c->algo);
+    HASH_update(c, pad, HASH_BLOCK);
+    HASH_update(c, inner, HASH_size(c->algo));
+    HASH_finish(c, digest);
+
+    HASH_wipe(pad, HASH_BLOCK);
+    HASH_wipe(inner, HASH_MAX_DIGEST);
+    HASH_wipe(c, sizeof(*c));
+}
+
+void HASH_compute(hash_algo_t algo, const void *data, uint32_t len, uint8_t *digest)
+{
+    hash_ctx_t c;
+
+    HASH_init(&c, algo);
+    HASH_update(&c, data, len);
+    HASH_final(&c, digest);
+}
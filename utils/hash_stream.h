@@ -0,0 +1,79 @@
+/******************************************************************************
+ * Project  : TM4C123 example utilities
+ * File     : hash_stream.h
+ *
+ * Description:
+ * Incremental SHA-224 / SHA-256 and HMAC (init / update / final) over the
+ * hardware SHA/MD5 module or driverlib's software SHA-256, so a message of
+ * any size can be hashed as it arrives or straight out of flash, in chunks
+ * of any size and alignment, with a context of 264 bytes.
+ *
+ * Engines:
+ *   - Hardware SHA/MD5 module (TM4C129 CCM0). The intermediate digest and
+ *     byte count are saved into the context after every run of blocks and
+ *     restored before the next, so any number of contexts can be in use at
+ *     once (not from interrupt handlers). The module is checked once per
+ *     algorithm against the software engine before it is trusted.
+ *   - driverlib/sw_shamd5.c on parts without it, including this LaunchPad.
+ *
+ * Both give the same digests, in the byte order of the standard's hex
+ * digest. For HMAC the key block and the padded-key copies are cleared from
+ * the stack and the context by HASH_final(), so no key material is left in
+ * RAM once the MAC is out.
+ *
+ * Author   : Jithin B.P.
+ * Affiliation: CSpark Research
+ * Email    : jithinuser@gmail.com
+ *
+ * License  : This source code is released under an open-source license.
+ * You may use, modify, and distribute it freely, provided that
+ * proper attribution is given to the original author.
+ *
+ * Created  : 2025
+ ******************************************************************************/
+
+#ifndef HASH_STREAM_H
+#define HASH_STREAM_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "driverlib/sw_shamd5.h"
+
+#define HASH_MAX_DIGEST     32          // Bytes, SHA-256
+#define HASH_BLOCK          64
+
+typedef enum {
+    HASH_SHA224,
+    HASH_SHA256
+} hash_algo_t;
+
+typedef enum {
+    HASH_ENGINE_HW,                     // SHA/MD5 module
+    HASH_ENGINE_SW                      // driverlib/sw_shamd5.c
+} hash_engine_t;
+
+typedef struct {
+    hash_algo_t algo;
+    hash_engine_t engine;
+    bool hmac;
+    uint8_t key[HASH_BLOCK];            // HMAC: the key block, for the outer hash
+    union {
+        tSWSHAMD5Context sw;
+        struct {
+            uint32_t digest[8];         // Saved IDIGEST A..H
+            uint32_t count;             // Saved DIGEST_COUNT
+            uint8_t block[HASH_BLOCK];  // Held back for the next run or final
+            uint32_t fill;
+            bool started;               // A run has gone through the module
+        } hw;
+    } u;
+} hash_ctx_t;
+
+uint32_t HASH_size(hash_algo_t algo);   // Digest bytes: 28 or 32
+void HASH_init(hash_ctx_t *c, hash_algo_t algo);
+void HASH_hmac_init(hash_ctx_t *c, hash_algo_t algo, const void *key, uint32_t key_len);
+void HASH_update(hash_ctx_t *c, const void *data, uint32_t len);
+void HASH_final(hash_ctx_t *c, uint8_t *digest);
+void HASH_compute(hash_algo_t algo, const void *data, uint32_t len, uint8_t *digest);
+
+#endif // HASH_STREAM_H
@@ -0,0 +1,468 @@
+/******************************************************************************
+ * Project  : TM4C123 example utilities
+ * File     : kv_store.c
+ *
+ * Description:
+ * Log-structured key-value store on the internal EEPROM. See kv_store.h.
+ *
+ * Words of a half (erased words read 0xFFFFFFFF):
+ *   0        header   'K' | generation:16 | CRC-8
+ *   1..      records, then erased words to the end
+ *
+ * Records:
+ *   short    0 | key:7 | value:16 | CRC-8             one word, 2-byte values
+ *   long     1 | key:7 | len:8 | CRC-16, then the data in (len + 3) / 4 words
+ *   delete   a long record with len 0
+ * The CRC-8 covers the upper 24 bits of the word; the CRC-16 covers the
+ * upper 16 bits and the data. An erased word would be key 127 with len 255,
+ * neither of which is allowed, so it never parses as a record.
+ *
+ * A long record's data goes in first and its header last. The log ends at
+ * the first word that is erased or fails its check; KV_init() erases
+ * anything after that, so the next append always lands on erased words.
+ *
+ * Compaction erases the other half (header first, so it stops counting as
+ * valid), copies each key's latest record across and finally writes that
+ * half's header with the next generation. Until that word is written the
+ * old half is the newer valid one, so a reset at any point keeps a
+ * complete store. Writes made while a compaction runs still go to the old
+ * half and mark their key to be copied again.
+ *
+ * Author   : Jithin B.P.
+ * Affiliation: CSpark Research
+ * Email    : jithinuser@gmail.com
+ *
+ * License  : This source code is released under an open-source license.
+ * You may use, modify, and distribute it freely, provided that
+ * proper attribution is given to the original author.
+ *
+ * Created  : 2025
+ ******************************************************************************/
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include "inc/hw_memmap.h"
+#include "driverlib/sysctl.h"
+#include "driverlib/eeprom.h"
+#include "driverlib/sw_crc.h"
+#include "kv_store.h"
+
+#define KV_ERASED           0xFFFFFFFFu
+#define KV_MAGIC            0x4B        // 'K'
+#define KV_LONG             0x80000000u
+#define KV_BLOCK_WORDS      16
+#define KV_DATA_WORDS       ((KV_VALUE_MAX + 3) / 4)
+#define KV_NONE             0xFF        // No key
+
+typedef enum {
+    KV_IDLE,
+    KV_ERASE,                           // Erasing the other half
+    KV_COPY                             // Copying live records into it
+} kv_state_t;
+
+uint32_t kv_compactions;
+
+static uint32_t kv_base[2];             // Byte address of each half
+static uint32_t kv_words;               // Words per half
+static uint8_t kv_active;               // Half holding the log
+static uint16_t kv_gen;
+static uint32_t kv_tail;                // First free word of the active half
+static uint16_t kv_index[KV_KEYS];      // Word of each key's record, 0 if none
+static uint32_t kv_live;                // Words of the records in kv_index
+
+static kv_state_t kv_state;
+static uint32_t kv_cpos;                // Erase cursor, then copy tail
+static uint32_t kv_pending[(KV_KEYS + 31) / 32];    // Keys still to copy
+
+// A write that completes a compaction itself goes straight into the new
+// half in place of the key's old record
+static uint8_t kv_over_key = KV_NONE;
+static const void *kv_over_data;
+static uint32_t kv_over_len;
+
+// ------------ Words ------------
+
+static uint32_t KV_read(uint8_t half, uint32_t i)
+{
+    uint32_t w;
+
+    EEPROMRead(&w, kv_base[half] + i * 4, 4);
+    return w;
+}
+
+static void KV_write(uint8_t half, uint32_t i, uint32_t w)
+{
+    EEPROMProgram(&w, kv_base[half] + i * 4, 4);
+}
+
+// CRC-8 of the upper 24 bits of w, most significant byte first
+static uint8_t KV_crc8(uint32_t w)
+{
+    uint8_t b[3] = {w >> 24, w >> 16, w >> 8};
+
+    return Crc8CCITT(0, b, 3);
+}
+
+static uint16_t KV_crc16(uint32_t hdr, const uint32_t *data, uint32_t len)
+{
+    uint8_t b[2] = {hdr >> 24, hdr >> 16};
+
+    return Crc16(Crc16(0, b, 2), (const uint8_t *)data, len);
+}
+
+static uint32_t KV_header(uint16_t gen)
+{
+    uint32_t w = ((uint32_t)KV_MAGIC << 24) | ((uint32_t)gen << 8);
+
+    return w | KV_crc8(w);
+}
+
+static bool KV_header_valid(uint32_t w)
+{
+    return (w >> 24) == KV_MAGIC && (w & 0xFF) == KV_crc8(w);
+}
+
+// ------------ Records ------------
+
+static uint8_t KV_rec_key(uint32_t hdr)
+{
+    return (hdr >> 24) & 0x7F;
+}
+
+static uint32_t KV_rec_len(uint32_t hdr)
+{
+    return (hdr & KV_LONG) ? (hdr >> 16) & 0xFF : 2;
+}
+
+static uint32_t KV_rec_words(uint32_t hdr)
+{
+    return (hdr & KV_LONG) ? 1 + (KV_rec_len(hdr) + 3) / 4 : 1;
+}
+
+static uint32_t KV_words_for(uint32_t len)
+{
+    return (len == 2) ? 1 : 1 + (len + 3) / 4;
+}
+
+// Reads a record's value into data (KV_DATA_WORDS words); returns its
+// length
+static uint32_t KV_rec_read(uint8_t half, uint32_t i, uint32_t *data)
+{
+    uint32_t hdr = KV_read(half, i);
+    uint32_t len = KV_rec_len(hdr);
+
+    if (hdr & KV_LONG)
+        EEPROMRead(data, kv_base[half] + (i + 1) * 4, (len + 3) & ~3u);
+    else
+        data[0] = (hdr >> 8) & 0xFFFF;
+    return len;
+}
+
+// Reads and checks the record at word i; false if there is none
+static bool KV_rec_check(uint8_t half, uint32_t i, uint32_t *hdr)
+{
+    uint32_t data[KV_DATA_WORDS];
+
+    *hdr = KV_read(half, i);
+    if (*hdr == KV_ERASED || KV_rec_key(*hdr) >= KV_KEYS)
+        return false;
+    if (!(*hdr & KV_LONG))
+        return (*hdr & 0xFF) == KV_crc8(*hdr);
+    if (KV_rec_len(*hdr) > KV_VALUE_MAX || i + KV_rec_words(*hdr) > kv_words)
+        return false;
+    KV_rec_read(half, i, data);
+    return (*hdr & 0xFFFF) == KV_crc16(*hdr, data, KV_rec_len(*hdr));
+}
+
+// Writes a record at word i, data first and the header last; len 0 is a
+// delete
+static void KV_rec_write(uint8_t half, uint32_t i, uint8_t key,
+                         const void *data, uint32_t len)
+{
+    uint32_t words[KV_DATA_WORDS] = {0};
+    uint32_t hdr, n;
+
+    if (len == 2) {
+        const uint8_t *d = data;
+
+        hdr = ((uint32_t)key << 24) | ((uint32_t)d[0] << 8) | ((uint32_t)d[1] << 16);
+        KV_write(half, i, hdr | KV_crc8(hdr));
+        return;
+    }
+
+    if (len)
+        memcpy(words, data, len);
+    hdr = KV_LONG | ((uint32_t)key << 24) | (len << 16);
+    hdr |= KV_crc16(hdr, words, len);
+    for (n = 0; n < (len + 3) / 4; n++)
+        KV_write(half, i + 1 + n, words[n]);
+    KV_write(half, i, hdr);
+}
+
+// ------------ Log ------------
+
+// Builds the index from a half's log and finds its end
+static void KV_scan(uint8_t half)
+{
+    uint32_t i = 1, hdr, k;
+
+    memset(kv_index, 0, sizeof(kv_index));
+    kv_live = 0;
+    while (i < kv_words && KV_rec_check(half, i, &hdr)) {
+        k = KV_rec_key(hdr);
+        if (kv_index[k])
+            kv_live -= KV_rec_words(KV_read(half, kv_index[k]));
+        kv_index[k] = 0;
+        if (KV_rec_len(hdr)) {
+            kv_index[k] = i;
+            kv_live += KV_rec_words(hdr);
+        }
+        i += KV_rec_words(hdr);
+    }
+    kv_tail = i;
+}
+
+static void KV_erase(uint8_t half, uint32_t i)
+{
+    if (KV_read(half, i) != KV_ERASED)
+        KV_write(half, i, KV_ERASED);
+}
+
+static void KV_pending_set(uint8_t key)
+{
+    kv_pending[key / 32] |= 1u << (key % 32);
+}
+
+// Lowest key still to copy, cleared; KV_NONE when done
+static uint8_t KV_pending_take(void)
+{
+    uint32_t i, b;
+
+    for (i = 0; i < (KV_KEYS + 31) / 32; i++) {
+        if (kv_pending[i]) {
+            for (b = 0; !(kv_pending[i] & (1u << b)); b++);
+            kv_pending[i] &= ~(1u << b);
+            return i * 32 + b;
+        }
+    }
+    return KV_NONE;
+}
+
+static void KV_compact_start(void)
+{
+    memset(kv_pending, 0, sizeof(kv_pending));
+    kv_cpos = 0;
+    kv_state = KV_ERASE;
+}
+
+// Copies key's current value (or the override) to the other half. A key
+// with no value gets a delete record, as it may have been copied before
+// it was deleted. Returns false if the half has no room left.
+static bool KV_copy(uint8_t key)
+{
+    uint32_t data[KV_DATA_WORDS];
+    uint32_t len = 0;
+    const void *d = data;
+
+    if (key == kv_over_key) {
+        d = kv_over_data;
+        len = kv_over_len;
+    } else if (kv_index[key]) {
+        len = KV_rec_read(kv_active, kv_index[key], data);
+    }
+
+    if (kv_cpos + KV_words_for(len) > kv_words)
+        return false;
+    KV_rec_write(!kv_active, kv_cpos, key, d, len);
+    kv_cpos += KV_words_for(len);
+    return true;
+}
+
+// One part of a compaction, up to budget words written. Returns true
+// while there is more to do.
+static bool KV_step(uint32_t budget)
+{
+    uint8_t dst = !kv_active;
+    uint32_t k;
+
+    while (budget) {
+        switch (kv_state) {
+        case KV_IDLE:
+            return false;
+
+        case KV_ERASE:
+            if (kv_cpos < kv_words) {
+                if (KV_read(dst, kv_cpos) != KV_ERASED) {
+                    KV_write(dst, kv_cpos, KV_ERASED);
+                    budget--;
+                }
+                kv_cpos++;
+                break;
+            }
+            for (k = 0; k < KV_KEYS; k++)
+                if (kv_index[k] || k == kv_over_key)
+                    KV_pending_set(k);
+            kv_cpos = 1;
+            kv_state = KV_COPY;
+            break;
+
+        case KV_COPY:
+            k = KV_pending_take();
+            if (k != KV_NONE) {
+                // Full of copies superseded during the compaction: again
+                if (!KV_copy(k))
+                    KV_compact_start();
+                budget--;
+                break;
+            }
+            KV_write(dst, 0, KV_header(kv_gen + 1));
+            kv_gen++;
+            kv_active = dst;
+            kv_state = KV_IDLE;
+            kv_compactions++;
+            KV_scan(kv_active);
+            return false;
+        }
+    }
+    return true;
+}
+
+// Compacts now, with key's record replaced by data (len 0: dropped)
+static void KV_compact_now(uint8_t key, const void *data, uint32_t len)
+{
+    if (kv_state == KV_IDLE)
+        KV_compact_start();
+    kv_over_key = key;
+    kv_over_data = data;
+    kv_over_len = len;
+    if (kv_state == KV_COPY)
+        KV_pending_set(key);
+    KV_step(~0u);
+    kv_over_key = KV_NONE;
+}
+
+// Appends a record for key (len 0: delete), compacting first if the log is
+// full
+static bool KV_append(uint8_t key, const void *data, uint32_t len)
+{
+    uint32_t words = KV_words_for(len);
+    uint32_t old = kv_index[key] ? KV_rec_words(KV_read(kv_active, kv_index[key])) : 0;
+    uint32_t live = kv_live - old + (len ? words : 0);
+
+    if (live > kv_words - 1)
+        return false;
+
+    if (kv_tail + words > kv_words) {
+        KV_compact_now(key, data, len);
+        return true;
+    }
+
+    KV_rec_write(kv_active, kv_tail, key, data, len);
+    kv_index[key] = len ? kv_tail : 0;
+    kv_tail += words;
+    kv_live = live;
+    if (kv_state == KV_COPY)
+        KV_pending_set(key);
+    return true;
+}
+
+// ------------ API ------------
+
+// Powers up the EEPROM, picks the newer valid half, builds the index and
+// erases anything after the end of the log. A store with no valid half is
+// formatted, empty. Returns false if the EEPROM does not start.
+bool KV_init(void)
+{
+    uint32_t h0, h1, i;
+
+    SysCtlPeripheralEnable(SYSCTL_PERIPH_EEPROM0);
+    while (!SysCtlPeripheralReady(SYSCTL_PERIPH_EEPROM0));
+    if (EEPROMInit() != EEPROM_INIT_OK)
+        return false;
+
+    kv_words = (EEPROMBlockCountGet() - KV_FIRST_BLOCK) * KV_BLOCK_WORDS / 2;
+    kv_base[0] = KV_FIRST_BLOCK * KV_BLOCK_WORDS * 4;
+    kv_base[1] = kv_base[0] + kv_words * 4;
+    kv_state = KV_IDLE;
+    kv_compactions = 0;
+
+    h0 = KV_read(0, 0);
+    h1 = KV_read(1, 0);
+    if (!KV_header_valid(h0) && !KV_header_valid(h1)) {
+        for (i = 0; i < kv_words; i++)
+            KV_erase(0, i);
+        KV_write(0, 0, KV_header(1));
+        h0 = KV_header(1);
+    }
+
+    if (!KV_header_valid(h1))
+        kv_active = 0;
+    else if (!KV_header_valid(h0))
+        kv_active = 1;
+    else
+        kv_active = (int16_t)((uint16_t)(h1 >> 8) - (uint16_t)(h0 >> 8)) > 0;
+    kv_gen = (kv_active ? h1 : h0) >> 8;
+
+    KV_scan(kv_active);
+    for (i = kv_tail; i < kv_words; i++)
+        KV_erase(kv_active, i);
+    return true;
+}
+
+// Copies up to size bytes of key's value into buf. Returns the value's
+// length, or -1 if the key has no value.
+int32_t KV_get(uint8_t key, void *buf, uint32_t size)
+{
+    uint32_t data[KV_DATA_WORDS];
+    uint32_t len;
+
+    if (key >= KV_KEYS || kv_index[key] == 0)
+        return -1;
+    len = KV_rec_read(kv_active, kv_index[key], data);
+    memcpy(buf, data, (len < size) ? len : size);
+    return len;
+}
+
+// Stores 1..KV_VALUE_MAX bytes; 2-byte values take one EEPROM word. A
+// value equal to the stored one is not written again. Returns false for a
+// bad key or length, or when the live values would not fit in a half.
+bool KV_set(uint8_t key, const void *data, uint32_t len)
+{
+    uint32_t cur[KV_DATA_WORDS];
+
+    if (key >= KV_KEYS || len == 0 || len > KV_VALUE_MAX)
+        return false;
+    if (KV_get(key, cur, sizeof(cur)) == (int32_t)len && memcmp(cur, data, len) == 0)
+        return true;
+    return KV_append(key, data, len);
+}
+
+bool KV_delete(uint8_t key)
+{
+    if (key >= KV_KEYS)
+        return false;
+    if (kv_index[key] == 0)
+        return true;
+    return KV_append(key, NULL, 0);
+}
+
+// Background compaction: starts one when fewer than KV_COMPACT_FREE log
+// words are left, late so that every word of the half takes its share of
+// the writes, then writes up to KV_STEP_WORDS words per call. Returns true
+// while a compaction is running.
+bool KV_service(void)
+{
+    if (kv_state == KV_IDLE) {
+        if (kv_words - kv_tail >= KV_COMPACT_FREE || kv_tail - 1 == kv_live)
+            return false;
+        KV_compact_start();
+    }
+    return KV_step(KV_STEP_WORDS);
+}
+
+// Words left before the log is full
+uint32_t KV_free_words(void)
+{
+    return kv_words - kv_tail;
+}
@@ -0,0 +1,57 @@
+/******************************************************************************
+ * Project  : TM4C123 example utilities
+ * File     : kv_store.h
+ *
+ * Description:
+ * Log-structured key-value store on the internal EEPROM. Values are never
+ * rewritten in place: every KV_set() appends a record after the last one,
+ * so successive updates land on fresh words and the wear spreads over the
+ * whole store instead of one word. A 2-byte value is a single-word record
+ * (one EEPROMProgram() word time); longer values take a header word plus
+ * their data. Each record carries a CRC, and a record is committed by its
+ * first word, written last, so a reset part way through a write leaves the
+ * previous value.
+ *
+ * The EEPROM blocks from KV_FIRST_BLOCK to EEPROMBlockCountGet() are split
+ * into two halves. One holds the log; when fewer than KV_COMPACT_FREE
+ * words are left, KV_service() copies the latest record of each key into
+ * the other half a few words per call and then switches halves, so call it
+ * from the main loop. If the log fills before that finishes, the write that
+ * needs the space completes the compaction first.
+ *
+ * KV_init() scans the log once and keeps, per key, where its latest record
+ * is, so reads do not search. Use from one context (main loop) only.
+ *
+ * Author   : Jithin B.P.
+ * Affiliation: CSpark Research
+ * Email    : jithinuser@gmail.com
+ *
+ * License  : This source code is released under an open-source license.
+ * You may use, modify, and distribute it freely, provided that
+ * proper attribution is given to the original author.
+ *
+ * Created  : 2025
+ ******************************************************************************/
+
+#ifndef KV_STORE_H
+#define KV_STORE_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#define KV_FIRST_BLOCK      0           // Blocks below this are left to the application
+#define KV_KEYS             64          // Keys 0..KV_KEYS-1, at most 127
+#define KV_VALUE_MAX        64          // Bytes, at most 254
+#define KV_COMPACT_FREE     32          // Free log words that start a background compaction
+#define KV_STEP_WORDS       4           // EEPROM words written per KV_service() call
+
+extern uint32_t kv_compactions;         // Halves switched since KV_init()
+
+bool KV_init(void);
+int32_t KV_get(uint8_t key, void *buf, uint32_t size);
+bool KV_set(uint8_t key, const void *data, uint32_t len);
+bool KV_delete(uint8_t key);
+bool KV_service(void);
+uint32_t KV_free_words(void);
+
+#endif // KV_STORE_H
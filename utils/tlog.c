@@ -0,0 +1,79 @@
+/******************************************************************************
+ * Project  : TM4C123 example utilities
+ * File     : tlog.c
+ *
+ * Description:
+ * Tokenized logging ring. See tlog.h.
+ *
+ * Author   : Jithin B.P.
+ * Affiliation: CSpark Research
+ * Email    : jithinuser@gmail.com
+ *
+ * License  : This source code is released under an open-source license.
+ * You may use, modify, and distribute it freely, provided that
+ * proper attribution is given to the original author.
+ *
+ * Created  : 2025
+ ******************************************************************************/
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "driverlib/interrupt.h"
+#include "uart_dma.h"
+#include "tlog.h"
+
+#define TLOG_MASK (TLOG_RING_WORDS - 1)
+
+static uint32_t tlog_ring[TLOG_RING_WORDS];
+static volatile uint32_t tlog_head;     // Next free word
+static volatile uint32_t tlog_tail;     // Next word to send
+volatile uint32_t tlog_dropped;
+
+// Starts the log with a record of the message table's hash
+void TLOG_init(uint32_t table_hash)
+{
+    tlog_head = tlog_tail = 0;
+    tlog_dropped = 0;
+    TLOG_write(TLOG_ID_TABLE, &table_hash, 1);
+}
+
+// Appends one record. Safe from any context: interrupts are masked only
+// for the copy, a handful of words.
+void TLOG_write(uint16_t id, const uint32_t *args, uint32_t nargs)
+{
+    bool masked = IntMasterDisable();
+    uint32_t head = tlog_head;
+    uint32_t i;
+
+    if (TLOG_RING_WORDS - (head - tlog_tail) < nargs + 1) {
+        tlog_dropped++;
+    } else {
+        tlog_ring[head++ & TLOG_MASK] = ((uint32_t)TLOG_MAGIC << 24) |
+                                        (nargs << 16) | id;
+        for (i = 0; i < nargs; i++)
+            tlog_ring[head++ & TLOG_MASK] = args[i];
+        tlog_head = head;
+    }
+
+    if (!masked) IntMasterEnable();
+}
+
+// Moves whole words from the log ring to the UART transmit ring, as much
+// as fits. Call it from the main loop; it never waits.
+void TLOG_drain(void)
+{
+    uint32_t idx, words, room;
+
+    while ((words = tlog_head - tlog_tail) != 0) {
+        idx = tlog_tail & TLOG_MASK;
+        if (words > TLOG_RING_WORDS - idx) words = TLOG_RING_WORDS - idx;
+        room = UART_tx_space() / 4;
+        if (words > room) words = room;
+        if (words == 0) return;
+
+        // Other output can take the space first; keep the words for the
+        // next call rather than lose them and the decoder's sync
+        if (!UART_tx_send(&tlog_ring[idx], words * 4)) return;
+        tlog_tail += words;
+    }
+}
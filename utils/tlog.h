@@ -0,0 +1,63 @@
+/******************************************************************************
+ * Project  : TM4C123 example utilities
+ * File     : tlog.h
+ *
+ * Description:
+ * Tokenized logging. A log call stores a 16-bit message ID and its
+ * arguments as raw 32-bit words in a RAM ring; no formatting happens on
+ * the MCU. TLOG_drain() sends the ring out as binary, and the host tool
+ * tlog/tlog_decode rebuilds the text from the message table.
+ *
+ *   TLOG(ADC_VALUE, "ADC Value: %4d\n", adcValue);
+ *
+ * The first argument names the message. tlog/tlog_gen.py scans the sources
+ * at build time (CCS pre-build step) and writes tlog_ids.h, which gives
+ * every name its ID and argument count, and tlog_table.txt for the decoder.
+ * The format string itself never reaches the flash image.
+ *
+ * Arguments are integers (%d %i %u %x %X %o %c); strings and floats cannot
+ * be deferred. A wrong argument count, or more than TLOG_MAX_ARGS, fails
+ * to compile; tlog_gen.py rejects the latter too.
+ *
+ * Wire format, little-endian 32-bit words:
+ *   header = 0xA5 << 24 | nargs << 16 | id, then nargs argument words.
+ * ID 0 carries the table hash, so the decoder can tell a stale table.
+ *
+ * Author   : Jithin B.P.
+ * Affiliation: CSpark Research
+ * Email    : jithinuser@gmail.com
+ *
+ * License  : This source code is released under an open-source license.
+ * You may use, modify, and distribute it freely, provided that
+ * proper attribution is given to the original author.
+ *
+ * Created  : 2025
+ ******************************************************************************/
+
+#ifndef TLOG_H
+#define TLOG_H
+
+#include <stdint.h>
+
+#define TLOG_RING_WORDS     512         // Power of two
+#define TLOG_MAGIC          0xA5
+#define TLOG_MAX_ARGS       8           // Same limit as MAX_ARGS in tlog_gen.py
+#define TLOG_ID_TABLE       0           // Record carrying the table hash
+
+// The argument array starts with a dummy word so that a call with no
+// arguments is still a valid initializer
+#define TLOG(name, fmt, ...)                                                  \
+    do {                                                                      \
+        const uint32_t tlog_w_[] = { 0, __VA_ARGS__ };                        \
+        (void)sizeof(char[(sizeof(tlog_w_) / 4 - 1 == TLOG_NARGS_##name &&   \
+                           TLOG_NARGS_##name <= TLOG_MAX_ARGS) ? 1 : -1]);    \
+        TLOG_write(TLOG_ID_##name, &tlog_w_[1], sizeof(tlog_w_) / 4 - 1);     \
+    } while (0)
+
+extern volatile uint32_t tlog_dropped;  // Records lost to a full ring
+
+void TLOG_init(uint32_t table_hash);
+void TLOG_write(uint16_t id, const uint32_t *args, uint32_t nargs);
+void TLOG_drain(void);
+
+#endif // TLOG_H
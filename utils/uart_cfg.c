@@ -0,0 +1,127 @@
+/******************************************************************************
+ * Project  : TM4C123 example utilities
+ * File     : uart_cfg.c
+ *
+ * Description:
+ * UART baud rate profiles and loopback self-test. See uart_cfg.h.
+ *
+ * Author   : Jithin B.P.
+ * Affiliation: CSpark Research
+ * Email    : jithinuser@gmail.com
+ *
+ * License  : This source code is released under an open-source license.
+ * You may use, modify, and distribute it freely, provided that
+ * proper attribution is given to the original author.
+ *
+ * Created  : 2025
+ ******************************************************************************/
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "inc/hw_memmap.h"
+#include "inc/hw_types.h"
+#include "inc/hw_uart.h"
+#include "driverlib/sysctl.h"
+#include "driverlib/uart.h"
+#include "uart_cfg.h"
+
+// Cortex-M4 cycle counter (DWT), used to time the self-test
+#define DEMCR           0xE000EDFC
+#define DEMCR_TRCENA    0x01000000
+#define DWT_CTRL        0xE0001000
+#define DWT_CYCCNT      0xE0001004
+
+const uint32_t uart_profile_baud[UART_PROFILE_COUNT] = {
+    115200, 921600, 2000000, 3000000, 5000000
+};
+
+// Sets 8N1 at the profile's rate from the system clock. Returns false if
+// the clock is too slow for the rate, the divisors miss it by more than
+// UART_BAUD_TOLERANCE_PPM, or flow control was asked for on a UART without
+// RTS/CTS.
+bool UART_configure(uint32_t base, uart_profile_t profile, bool flow)
+{
+    uint32_t clk = SysCtlClockGet();
+    uint32_t baud = uart_profile_baud[profile];
+    uint32_t actual, config;
+    int32_t err;
+
+    if (baud > clk / 8) return false;
+    if (flow && base != UART1_BASE) return false;
+
+    UARTClockSourceSet(base, UART_CLOCK_SYSTEM);
+    UARTConfigSetExpClk(base, clk, baud, UART_CONFIG_WLEN_8 |
+                        UART_CONFIG_STOP_ONE | UART_CONFIG_PAR_NONE);
+    UARTFlowControlSet(base, flow ? (UART_FLOWCONTROL_TX | UART_FLOWCONTROL_RX) :
+                                    UART_FLOWCONTROL_NONE);
+
+    UARTConfigGetExpClk(base, clk, &actual, &config);
+    err = (int32_t)(((int64_t)actual - baud) * 1000000 / baud);
+    return (err < 0 ? -err : err) <= UART_BAUD_TOLERANCE_PPM;
+}
+
+// Pattern byte number i; not periodic in 256 so dropped bytes show up
+static uint8_t UART_test_byte(uint32_t i)
+{
+    return (uint8_t)(i ^ (i >> 8) ^ (i >> 16));
+}
+
+// Runs bytes through the UART in internal loopback (UnTx -> UnRx) at the
+// profile's rate and fills *res. The UART is left configured for the
+// profile, loopback off. Run it before uDMA or interrupts take the UART.
+// Passes if every byte came back intact at 90% of line rate or better.
+bool UART_self_test(uint32_t base, uart_profile_t profile, uint32_t bytes,
+                    uart_selftest_t *res)
+{
+    uint32_t clk = SysCtlClockGet();
+    uint32_t tx = 0, rx = 0, start, cycles, limit, config;
+    int32_t c;
+    bool ok;
+
+    res->baud = uart_profile_baud[profile];
+    res->bytes = res->errors = res->bytes_per_s = res->efficiency_pm = 0;
+    res->actual_baud = 0;
+    res->error_ppm = 0;
+
+    ok = UART_configure(base, profile, false);
+    if (res->baud > clk / 8) return false;
+    UARTConfigGetExpClk(base, clk, &res->actual_baud, &config);
+    res->error_ppm = (int32_t)(((int64_t)res->actual_baud - res->baud) *
+                               1000000 / res->baud);
+
+    HWREG(DEMCR) |= DEMCR_TRCENA;
+    HWREG(DWT_CTRL) |= 1;
+
+    // Expected time is 10 bits per byte; give up at twice that
+    limit = (uint32_t)(((uint64_t)bytes * 20 * clk) / res->baud) + clk / 1000;
+
+    HWREG(base + UART_O_CTL) |= UART_CTL_LBE;
+    while(UARTCharsAvail(base)) UARTCharGetNonBlocking(base);
+    UARTRxErrorClear(base);
+
+    // Keep at most 16 bytes between TX and RX so the RX FIFO cannot overrun
+    start = HWREG(DWT_CYCCNT);
+    while (rx < bytes) {
+        if (tx < bytes && tx - rx < 16 && UARTSpaceAvail(base))
+            HWREG(base + UART_O_DR) = UART_test_byte(tx++);
+
+        if (UARTCharsAvail(base)) {
+            c = HWREG(base + UART_O_DR);
+            if (c != UART_test_byte(rx)) res->errors++;  // Error bits make it differ too
+            rx++;
+        }
+
+        if (HWREG(DWT_CYCCNT) - start > limit) break;
+    }
+    cycles = HWREG(DWT_CYCCNT) - start;
+
+    while(UARTBusy(base));
+    HWREG(base + UART_O_CTL) &= ~UART_CTL_LBE;
+
+    res->bytes = rx;
+    res->errors += bytes - rx;
+    res->bytes_per_s = (uint32_t)(((uint64_t)rx * clk) / (cycles ? cycles : 1));
+    res->efficiency_pm = (uint32_t)(((uint64_t)res->bytes_per_s * 10000) / res->baud);
+
+    return ok && res->errors == 0 && res->efficiency_pm >= 900;
+}
@@ -0,0 +1,62 @@
+/******************************************************************************
+ * Project  : TM4C123 example utilities
+ * File     : uart_cfg.h
+ *
+ * Description:
+ * UART baud rate profiles clocked from the system clock, and a loopback
+ * self-test that reports the achieved baud error and sustained throughput.
+ *
+ * The UART divides its clock by 16, or by 8 in high-speed mode, so the
+ * fastest rate is SysClk / 8: 5 Mbaud at 40 MHz, 10 Mbaud at 80 MHz.
+ * The LaunchPad's ICDI virtual COM port only handles the low profiles;
+ * use an external USB-UART adapter for the fast ones.
+ *
+ * RTS/CTS flow control exists only on UART1 (U1RTS/U1CTS on PC4/PC5 or
+ * PF0/PF1); the caller muxes those pins.
+ *
+ * Author   : Jithin B.P.
+ * Affiliation: CSpark Research
+ * Email    : jithinuser@gmail.com
+ *
+ * License  : This source code is released under an open-source license.
+ * You may use, modify, and distribute it freely, provided that
+ * proper attribution is given to the original author.
+ *
+ * Created  : 2025
+ ******************************************************************************/
+
+#ifndef UART_CFG_H
+#define UART_CFG_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#define UART_BAUD_TOLERANCE_PPM 20000   // 2%: 8N1 still samples inside the bit
+
+typedef enum {
+    UART_PROFILE_115200,
+    UART_PROFILE_921600,
+    UART_PROFILE_2M,
+    UART_PROFILE_3M,
+    UART_PROFILE_5M,
+    UART_PROFILE_COUNT
+} uart_profile_t;
+
+extern const uint32_t uart_profile_baud[UART_PROFILE_COUNT];
+
+// Loopback self-test result
+typedef struct {
+    uint32_t baud;                      // Requested
+    uint32_t actual_baud;               // From the programmed divisors
+    int32_t error_ppm;                  // actual vs requested
+    uint32_t bytes;                     // Bytes that came back
+    uint32_t errors;                    // Wrong data, framing or overrun
+    uint32_t bytes_per_s;               // Sustained rate
+    uint32_t efficiency_pm;             // bytes_per_s vs baud / 10, per mille
+} uart_selftest_t;
+
+bool UART_configure(uint32_t base, uart_profile_t profile, bool flow);
+bool UART_self_test(uint32_t base, uart_profile_t profile, uint32_t bytes,
+                    uart_selftest_t *res);
+
+#endif // UART_CFG_H
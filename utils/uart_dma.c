@@ -0,0 +1,496 @@
+/******************************************************************************
+ * Project  : TM4C123 example utilities
+ * File     : uart_dma.c
+ *
+ * Description:
+ * uDMA-driven buffered UART transmit. See uart_dma.h.
+ *
+ * The ring is indexed by free-running counters: the writer only moves
+ * head, the interrupt only moves tail. Each uDMA transfer covers the
+ * contiguous run from tail to head or to the end of the ring; when it
+ * completes the UART interrupt fires and the next run is started.
+ *
+ * Receive works the same way in reverse, with one twist: the receive
+ * timeout only fires while the RX FIFO holds data. The RX channel takes
+ * bursts only (4 bytes at the 1/4-full mark), so a frame whose length is
+ * not a multiple of 4 leaves 1-3 bytes in the FIFO, and the timeout
+ * interrupt stops the channel, copies them in and closes the frame. A
+ * frame of 4, 8, 12... bytes leaves the FIFO empty and no timeout comes,
+ * so a periodic idle timer (every 16 bit times) watches the channel's
+ * progress as well and closes an open frame once nothing has moved for two
+ * ticks. The timer only runs while a frame is open: the RX level interrupt
+ * (the same 1/4-full mark that requests a burst) starts it, and closing
+ * the frame stops it, so an idle line costs no interrupts. Leave the timer
+ * and UART interrupts at the same priority (both are at the reset default)
+ * so neither preempts the other.
+ *
+ * Author   : Jithin B.P.
+ * Affiliation: CSpark Research
+ * Email    : jithinuser@gmail.com
+ *
+ * License  : This source code is released under an open-source license.
+ * You may use, modify, and distribute it freely, provided that
+ * proper attribution is given to the original author.
+ *
+ * Created  : 2025
+ ******************************************************************************/
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdarg.h>
+#include <stdio.h>
+#include "inc/hw_memmap.h"
+#include "inc/hw_ints.h"
+#include "inc/hw_types.h"
+#include "inc/hw_uart.h"
+#include "driverlib/interrupt.h"
+#include "driverlib/sysctl.h"
+#include "driverlib/timer.h"
+#include "driverlib/uart.h"
+#include "driverlib/udma.h"
+#include "dma.h"
+#include "uart_dma.h"
+
+#define UART_TX_MASK (UART_TX_RING_SIZE - 1)
+#define UART_RX_MASK (UART_RX_RING_SIZE - 1)
+
+static uint8_t uart_tx_ring[UART_TX_RING_SIZE];
+static volatile uint32_t uart_tx_head;      // Next free byte
+static volatile uint32_t uart_tx_tail;      // Next byte to send
+static volatile uint32_t uart_tx_inflight;  // Bytes in the running transfer
+volatile uint32_t uart_tx_dropped;
+
+static uint8_t uart_rx_ring[UART_RX_RING_SIZE];
+static volatile uint32_t uart_rx_wr;        // Bytes received and accounted for
+static volatile uint32_t uart_rx_rd;        // Bytes released by the application
+static uint32_t uart_rx_frame_start;        // Start of the frame being received
+static volatile uint32_t uart_rx_armed;     // Bytes in the running transfer
+static uint32_t uart_rx_frames[UART_RX_FRAMES];  // End of each closed frame
+static volatile uint32_t uart_rx_fq_head;   // Frames closed (interrupt)
+static volatile uint32_t uart_rx_fq_tail;   // Frames released (application)
+static uint32_t uart_rx_frame_begin;        // Start of the oldest unreleased frame
+static uint32_t uart_rx_seen;               // Bytes received at the last idle tick
+static uint32_t uart_rx_quiet;              // Idle ticks with no new byte
+volatile uint32_t uart_rx_overflows;
+volatile uint32_t uart_rx_errors;
+
+// Starts the next transfer if the channel is idle. Runs in the interrupt,
+// or in the writer with the UART interrupt masked.
+static void UART_tx_kick(void)
+{
+    uint32_t pending, idx, len;
+
+    if (uart_tx_inflight) return;
+    pending = uart_tx_head - uart_tx_tail;
+    if (pending == 0) return;
+
+    idx = uart_tx_tail & UART_TX_MASK;
+    len = UART_TX_RING_SIZE - idx;
+    if (len > pending) len = pending;
+
+    uDMAChannelTransferSet(UART_DMA_TX_CHANNEL | UDMA_PRI_SELECT, UDMA_MODE_BASIC,
+                           &uart_tx_ring[idx],
+                           (void *)(UART_DMA_BASE + UART_O_DR), len);
+    uart_tx_inflight = len;
+    uDMAChannelEnable(UART_DMA_TX_CHANNEL);
+}
+
+// Hands the UART transmitter over to uDMA
+void UART_tx_init(void)
+{
+    DMA_init();
+
+    uDMAChannelAssign(UDMA_CH9_UART0TX);
+    uDMAChannelAttributeDisable(UART_DMA_TX_CHANNEL,
+                                UDMA_ATTR_ALTSELECT | UDMA_ATTR_USEBURST |
+                                UDMA_ATTR_HIGH_PRIORITY | UDMA_ATTR_REQMASK);
+
+    // The TX FIFO requests at half empty, so 4-byte bursts never overflow it
+    uDMAChannelControlSet(UART_DMA_TX_CHANNEL | UDMA_PRI_SELECT,
+                          UDMA_SIZE_8 | UDMA_SRC_INC_8 | UDMA_DST_INC_NONE |
+                          UDMA_ARB_4);
+    UARTFIFOLevelSet(UART_DMA_BASE, UART_FIFO_TX4_8, UART_FIFO_RX2_8);
+
+    UARTDMAEnable(UART_DMA_BASE, UART_DMA_TX);
+    IntEnable(UART_DMA_INT);
+}
+
+// Queues len bytes, turning "\n" into "\r\n" like UARTprintf. Never blocks;
+// what does not fit is dropped and counted. Returns the bytes queued.
+uint32_t UART_tx_write(const char *buf, uint32_t len)
+{
+    uint32_t head = uart_tx_head;
+    uint32_t space = UART_TX_RING_SIZE - (head - uart_tx_tail);
+    uint32_t i;
+
+    for (i = 0; i < len; i++) {
+        if (buf[i] == '\n') {
+            if (space < 2) break;
+            uart_tx_ring[head++ & UART_TX_MASK] = '\r';
+            space--;
+        } else if (space < 1) {
+            break;
+        }
+        uart_tx_ring[head++ & UART_TX_MASK] = buf[i];
+        space--;
+    }
+    uart_tx_dropped += len - i;
+    uart_tx_head = head;
+
+    IntDisable(UART_DMA_INT);
+    UART_tx_kick();
+    IntEnable(UART_DMA_INT);
+    return i;
+}
+
+// Queues binary data as is, all or nothing. Returns false if it does not
+// fit; nothing is counted as dropped, the caller decides.
+bool UART_tx_send(const void *buf, uint32_t len)
+{
+    const uint8_t *src = buf;
+    uint32_t head = uart_tx_head;
+    uint32_t i;
+
+    if (len > UART_TX_RING_SIZE - (head - uart_tx_tail)) return false;
+
+    for (i = 0; i < len; i++)
+        uart_tx_ring[head++ & UART_TX_MASK] = src[i];
+    uart_tx_head = head;
+
+    IntDisable(UART_DMA_INT);
+    UART_tx_kick();
+    IntEnable(UART_DMA_INT);
+    return true;
+}
+
+// Free space in the ring
+uint32_t UART_tx_space(void)
+{
+    return UART_TX_RING_SIZE - (uart_tx_head - uart_tx_tail);
+}
+
+// printf-style write through the ring. Formatting still costs CPU time,
+// but nothing waits for the UART.
+uint32_t UART_tx_printf(const char *fmt, ...)
+{
+    char line[UART_TX_LINE_MAX];
+    va_list args;
+    int len;
+
+    va_start(args, fmt);
+    len = vsnprintf(line, sizeof(line), fmt, args);
+    va_end(args);
+
+    if (len < 0) return 0;
+    if (len >= (int)sizeof(line)) len = sizeof(line) - 1;
+    return UART_tx_write(line, len);
+}
+
+static void UART_tx_sink_put(fmt_sink_t *sink, const char *s, uint32_t len)
+{
+    (void)sink;
+    UART_tx_write(s, len);
+}
+
+fmt_sink_t uart_tx_sink = { UART_tx_sink_put };
+
+// Bytes queued or in flight
+uint32_t UART_tx_pending(void)
+{
+    return uart_tx_head - uart_tx_tail;
+}
+
+// Waits until everything queued has reached the UART FIFO and left the wire
+void UART_tx_flush(void)
+{
+    while(UART_tx_pending());
+    while(UARTBusy(UART_DMA_BASE));
+}
+
+// Points the RX channel at the free run of the ring after uart_rx_wr. If
+// the ring is full the channel stays off until the application releases a
+// frame. Runs in the UART or idle timer interrupt, or with both masked.
+static void UART_rx_arm(void)
+{
+    uint32_t idx, len, space;
+
+    if (uart_rx_armed) return;
+
+    idx = uart_rx_wr & UART_RX_MASK;
+    space = UART_RX_RING_SIZE - (uart_rx_wr - uart_rx_rd);
+    len = UART_RX_RING_SIZE - idx;
+    if (len > space) len = space;
+    if (len == 0) return;
+
+    uDMAChannelTransferSet(UART_DMA_RX_CHANNEL | UDMA_PRI_SELECT, UDMA_MODE_BASIC,
+                           (void *)(UART_DMA_BASE + UART_O_DR),
+                           &uart_rx_ring[idx], len);
+    uart_rx_armed = len;
+    uDMAChannelEnable(UART_DMA_RX_CHANNEL);
+}
+
+// Takes over the UART receiver with uDMA, and the idle timer
+void UART_rx_init(void)
+{
+    uint32_t uart_clk, baud, config;
+
+    DMA_init();
+
+    uDMAChannelAssign(UDMA_CH8_UART0RX);
+    uDMAChannelAttributeDisable(UART_DMA_RX_CHANNEL,
+                                UDMA_ATTR_ALTSELECT | UDMA_ATTR_HIGH_PRIORITY |
+                                UDMA_ATTR_REQMASK);
+    uDMAChannelAttributeEnable(UART_DMA_RX_CHANNEL, UDMA_ATTR_USEBURST);
+    uDMAChannelControlSet(UART_DMA_RX_CHANNEL | UDMA_PRI_SELECT,
+                          UDMA_SIZE_8 | UDMA_SRC_INC_NONE | UDMA_DST_INC_8 |
+                          UDMA_ARB_4);
+    UARTFIFOLevelSet(UART_DMA_BASE, UART_FIFO_TX4_8, UART_FIFO_RX2_8);
+
+    uart_rx_wr = uart_rx_rd = uart_rx_frame_start = uart_rx_frame_begin = 0;
+    uart_rx_fq_head = uart_rx_fq_tail = 0;
+    uart_rx_seen = uart_rx_quiet = 0;
+    UART_rx_arm();
+
+    UARTRxErrorClear(UART_DMA_BASE);
+    UARTIntClear(UART_DMA_BASE, UART_INT_RX);
+    UARTDMAEnable(UART_DMA_BASE, UART_DMA_RX);
+    UARTIntEnable(UART_DMA_BASE, UART_INT_RX | UART_INT_RT | UART_INT_OE);
+    IntEnable(UART_DMA_INT);
+
+    // Idle tick every 16 bit times at the configured rate, started by the
+    // first burst of a frame
+    if (UARTClockSourceGet(UART_DMA_BASE) == UART_CLOCK_PIOSC)
+        uart_clk = 16000000;
+    else
+        uart_clk = SysCtlClockGet();
+    UARTConfigGetExpClk(UART_DMA_BASE, uart_clk, &baud, &config);
+
+    SysCtlPeripheralEnable(UART_DMA_IDLE_PERIPH);
+    while (!SysCtlPeripheralReady(UART_DMA_IDLE_PERIPH));
+    TimerConfigure(UART_DMA_IDLE_TIMER, TIMER_CFG_PERIODIC);
+    TimerLoadSet(UART_DMA_IDLE_TIMER, TIMER_A,
+                 (uint32_t)(((uint64_t)SysCtlClockGet() * 16) / baud) - 1);
+    TimerIntEnable(UART_DMA_IDLE_TIMER, TIMER_TIMA_TIMEOUT);
+    IntEnable(UART_DMA_IDLE_INT);
+}
+
+// First burst of a frame: watch for the line going idle, and stop taking
+// the level interrupt until the frame closes
+static void UART_rx_idle_start(void)
+{
+    UARTIntDisable(UART_DMA_BASE, UART_INT_RX);
+    uart_rx_quiet = 0;
+    TimerEnable(UART_DMA_IDLE_TIMER, TIMER_A);
+}
+
+// Frame closed: stop the idle timer and wait for the next frame's first
+// burst. Called with the RX channel stopped and the FIFO empty.
+static void UART_rx_idle_stop(void)
+{
+    TimerDisable(UART_DMA_IDLE_TIMER, TIMER_A);
+    TimerIntClear(UART_DMA_IDLE_TIMER, TIMER_TIMA_TIMEOUT);
+    UARTIntClear(UART_DMA_BASE, UART_INT_RX);
+    UARTIntEnable(UART_DMA_BASE, UART_INT_RX);
+}
+
+// Line went idle: account for what uDMA moved, copy in the bytes left
+// below the burst size, and close the frame
+static void UART_rx_idle(void)
+{
+    uint32_t n;
+    int32_t c;
+    bool full = false;
+
+    // No new bursts while the channel is being reprogrammed
+    UARTDMADisable(UART_DMA_BASE, UART_DMA_RX);
+    if (uart_rx_armed) {
+        n = uDMAChannelSizeGet(UART_DMA_RX_CHANNEL | UDMA_PRI_SELECT);
+        uDMAChannelDisable(UART_DMA_RX_CHANNEL);
+        uart_rx_wr += uart_rx_armed - n;
+        uart_rx_armed = 0;
+    }
+
+    // Bytes that do not fit are dropped, so a full ring cannot keep the
+    // timeout interrupt firing
+    while (UARTCharsAvail(UART_DMA_BASE)) {
+        c = UARTCharGetNonBlocking(UART_DMA_BASE);
+        if (uart_rx_wr - uart_rx_rd == UART_RX_RING_SIZE) {
+            full = true;
+            continue;
+        }
+        uart_rx_ring[uart_rx_wr++ & UART_RX_MASK] = (uint8_t)c;
+    }
+    if (full) uart_rx_overflows++;
+
+    // Framing, parity and break errors are only flagged in the status
+    // register once uDMA has taken the data
+    if (UARTRxErrorGet(UART_DMA_BASE)) {
+        uart_rx_errors++;
+        UARTRxErrorClear(UART_DMA_BASE);
+    }
+
+    // With the descriptor queue full the frame stays open, and the idle
+    // timer keeps running so a later idle closes a longer one; nothing is
+    // lost
+    if (uart_rx_wr != uart_rx_frame_start &&
+        uart_rx_fq_head - uart_rx_fq_tail < UART_RX_FRAMES) {
+        uart_rx_frames[uart_rx_fq_head % UART_RX_FRAMES] = uart_rx_wr;
+        uart_rx_fq_head++;
+        uart_rx_frame_start = uart_rx_wr;
+    }
+    if (uart_rx_wr == uart_rx_frame_start) UART_rx_idle_stop();
+
+    UART_rx_arm();
+    UARTDMAEnable(UART_DMA_BASE, UART_DMA_RX);
+}
+
+// Returns the oldest received frame, without removing it
+bool UART_rx_frame_get(uart_frame_t *frame)
+{
+    uint32_t start, idx, len;
+
+    if (uart_rx_fq_tail == uart_rx_fq_head) return false;
+
+    start = uart_rx_frame_begin;
+    frame->end = uart_rx_frames[uart_rx_fq_tail % UART_RX_FRAMES];
+    len = frame->end - start;
+    idx = start & UART_RX_MASK;
+
+    frame->data = &uart_rx_ring[idx];
+    if (idx + len <= UART_RX_RING_SIZE) {
+        frame->len = len;
+        frame->data2 = 0;
+        frame->len2 = 0;
+    } else {
+        frame->len = UART_RX_RING_SIZE - idx;
+        frame->data2 = &uart_rx_ring[0];
+        frame->len2 = len - frame->len;
+    }
+    return true;
+}
+
+// Gives the oldest frame's bytes back to the receiver
+void UART_rx_frame_release(const uart_frame_t *frame)
+{
+    uart_rx_frame_begin = frame->end;
+    uart_rx_fq_tail++;
+
+    // Both interrupts reach UART_rx_arm() through UART_rx_idle()
+    IntDisable(UART_DMA_INT);
+    IntDisable(UART_DMA_IDLE_INT);
+    uart_rx_rd = frame->end;
+    UART_rx_arm();              // In case the ring had filled up
+    IntEnable(UART_DMA_IDLE_INT);
+    IntEnable(UART_DMA_INT);
+}
+
+// Byte i of a frame, across the wrap
+uint8_t UART_frame_byte(const uart_frame_t *frame, uint16_t i)
+{
+    return i < frame->len ? frame->data[i] : frame->data2[i - frame->len];
+}
+
+// UART interrupt: on this part, a finished peripheral uDMA transfer is
+// signalled on the peripheral's own vector
+void UART0IntHandler(void)
+{
+    uint32_t status = UARTIntStatus(UART_DMA_BASE, true);
+
+    UARTIntClear(UART_DMA_BASE, status);
+
+    if (uart_tx_inflight && !uDMAChannelIsEnabled(UART_DMA_TX_CHANNEL)) {
+        uart_tx_tail += uart_tx_inflight;
+        uart_tx_inflight = 0;
+        UART_tx_kick();
+    }
+
+    // RX run filled: carry on in the next one
+    if (uart_rx_armed && !uDMAChannelIsEnabled(UART_DMA_RX_CHANNEL)) {
+        uart_rx_wr += uart_rx_armed;
+        uart_rx_armed = 0;
+        UART_rx_arm();
+    }
+
+    if (status & UART_INT_OE) {
+        uart_rx_errors++;
+        UARTRxErrorClear(UART_DMA_BASE);
+    }
+
+    if (status & UART_INT_RX) UART_rx_idle_start();
+    if (status & UART_INT_RT) UART_rx_idle();
+}
+
+// Idle timer: closes a frame that uDMA took in whole bursts, which leaves
+// nothing in the FIFO for the receive timeout
+void UARTRxIdleIntHandler(void)
+{
+    uint32_t pos = uart_rx_wr;
+
+    TimerIntClear(UART_DMA_IDLE_TIMER, TIMER_TIMA_TIMEOUT);
+
+    if (uart_rx_armed)
+        pos += uart_rx_armed -
+               uDMAChannelSizeGet(UART_DMA_RX_CHANNEL | UDMA_PRI_SELECT);
+
+    if (pos != uart_rx_seen) {
+        uart_rx_seen = pos;
+        uart_rx_quiet = 0;
+        return;
+    }
+
+    // Nothing open, or bytes in the FIFO that the timeout will pick up
+    if (pos == uart_rx_frame_start || UARTCharsAvail(UART_DMA_BASE)) return;
+
+    if (++uart_rx_quiet >= 2) {
+        uart_rx_quiet = 0;
+        UART_rx_idle();
+    }
+}
+
+// Sends frames of 3, 4, 8, 12 and 13 bytes through the UART in internal
+// loopback and checks each one comes back as one frame, intact. Whole-burst
+// lengths only close on the idle timer. Call after UART_tx_init(),
+// UART_rx_init() and IntMasterEnable(), with no other traffic. Returns the
+// number of frames that failed.
+uint32_t UART_rx_frame_test(void)
+{
+    static const uint8_t lengths[] = {3, 4, 8, 12, 13};
+    uint8_t msg[16];
+    uart_frame_t frame;
+    uint32_t i, j, wait, failed = 0;
+    bool got;
+
+    UART_tx_flush();
+    while (UARTBusy(UART_DMA_BASE));
+    HWREG(UART_DMA_BASE + UART_O_CTL) |= UART_CTL_LBE;
+
+    for (i = 0; i < sizeof(lengths); i++) {
+        for (j = 0; j < lengths[i]; j++)
+            msg[j] = (uint8_t)(0xA0 + i * 16 + j);
+        UART_tx_send(msg, lengths[i]);
+
+        // The frame, then at most three idle ticks: about 100 ms is plenty
+        got = false;
+        for (wait = 0; wait < 1000 && !got; wait++) {
+            got = UART_rx_frame_get(&frame);
+            if (!got) SysCtlDelay(SysCtlClockGet() / 30000);
+        }
+        if (!got) {
+            failed++;
+            continue;
+        }
+        if (frame.len + frame.len2 != lengths[i])
+            failed++;
+        else
+            for (j = 0; j < lengths[i]; j++)
+                if (UART_frame_byte(&frame, j) != msg[j]) {
+                    failed++;
+                    break;
+                }
+        UART_rx_frame_release(&frame);
+    }
+
+    while (UARTBusy(UART_DMA_BASE));
+    HWREG(UART_DMA_BASE + UART_O_CTL) &= ~UART_CTL_LBE;
+    return failed;
+}
@@ -0,0 +1,86 @@
+/******************************************************************************
+ * Project  : TM4C123 example utilities
+ * File     : uart_dma.h
+ *
+ * Description:
+ * Buffered UART transmit and receive on uDMA.
+ *
+ * Transmit: writes go into a RAM ring and return at once; the uDMA engine
+ * drains the ring into the UART FIFO in the background, so logging no
+ * longer waits on the baud rate. Call UART_tx_init() after the UART itself
+ * is configured (e.g. by UART_configure()), then use UART_tx_printf() in
+ * place of UARTprintf(). Writes must come from one context (main loop),
+ * not from interrupts.
+ *
+ * Receive: uDMA writes incoming bytes into a RAM ring. When the line goes
+ * quiet for 32 bit times the receive timeout interrupt, or for frames
+ * uDMA took in whole 4-byte bursts the idle timer (32-48 bit times),
+ * closes a frame. The idle timer only runs while a frame is open. Put
+ * UARTRxIdleIntHandler() in the vector table.
+ * Frames are handed out as slices of the ring itself, with no copy; a frame
+ * that wraps around the end of the ring comes as two slices. Release each
+ * frame when done with it so its bytes can be reused.
+ *
+ * Author   : Jithin B.P.
+ * Affiliation: CSpark Research
+ * Email    : jithinuser@gmail.com
+ *
+ * License  : This source code is released under an open-source license.
+ * You may use, modify, and distribute it freely, provided that
+ * proper attribution is given to the original author.
+ *
+ * Created  : 2025
+ ******************************************************************************/
+
+#ifndef UART_DMA_H
+#define UART_DMA_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "fmt.h"
+
+// ------------ UART hardware ------------
+#define UART_DMA_BASE       UART0_BASE
+#define UART_DMA_INT        INT_UART0
+#define UART_DMA_TX_CHANNEL UDMA_CHANNEL_UART0TX
+#define UART_DMA_RX_CHANNEL UDMA_CHANNEL_UART0RX
+#define UART_DMA_IDLE_TIMER TIMER5_BASE     // RX idle timer, Timer5A periodic
+#define UART_DMA_IDLE_PERIPH SYSCTL_PERIPH_TIMER5
+#define UART_DMA_IDLE_INT   INT_TIMER5A
+
+#define UART_TX_RING_SIZE   1024        // Power of two, at most 1024 (one uDMA transfer)
+#define UART_TX_LINE_MAX    128         // Longest UART_tx_printf() output
+#define UART_RX_RING_SIZE   1024        // Power of two, at most 1024
+#define UART_RX_FRAMES      8           // Frames waiting for the application
+
+// A received frame: data[0..len-1] then data2[0..len2-1] (len2 is 0 unless
+// the frame wraps). Points into the receive ring; valid until released.
+typedef struct {
+    const uint8_t *data;
+    uint16_t len;
+    const uint8_t *data2;
+    uint16_t len2;
+    uint32_t end;                       // Ring position after the frame
+} uart_frame_t;
+
+extern fmt_sink_t uart_tx_sink;             // FMT_PRINT() target for UART_tx_write()
+extern volatile uint32_t uart_tx_dropped;   // Bytes lost to a full ring
+extern volatile uint32_t uart_rx_overflows; // Times the RX ring filled up
+extern volatile uint32_t uart_rx_errors;    // Framing, parity, break or overrun
+
+void UART_tx_init(void);
+uint32_t UART_tx_write(const char *buf, uint32_t len);
+uint32_t UART_tx_printf(const char *fmt, ...);
+bool UART_tx_send(const void *buf, uint32_t len);
+uint32_t UART_tx_space(void);
+uint32_t UART_tx_pending(void);
+void UART_tx_flush(void);
+void UART_rx_init(void);
+bool UART_rx_frame_get(uart_frame_t *frame);
+void UART_rx_frame_release(const uart_frame_t *frame);
+uint8_t UART_frame_byte(const uart_frame_t *frame, uint16_t i);
+uint32_t UART_rx_frame_test(void);
+void UART0IntHandler(void);
+void UARTRxIdleIntHandler(void);
+
+#endif // UART_DMA_H